@@ -13,6 +13,8 @@
 #include "MeshAnalysis.h"
 
 #include <algorithm>
+#include <chrono>
+#include <cfloat>
 
 #ifdef DEBUG_CFD_MESH
 // #include <direct.h>
@@ -147,7 +149,7 @@ void CfdMeshMgrSingleton::GenerateMesh()
     //addOutputText( qual.c_str() );
 
     addOutputText( "Build Single Tag Map\n" );
-    SubSurfaceMgr.BuildSingleTagMap();
+    UpdateSubSurfTagMaps();
 
     addOutputText( "Exporting Files\n" );
     ExportFiles();
@@ -678,6 +680,8 @@ void CfdMeshMgrSingleton::BuildTargetMap( int output_type )
     MSCloud ms_cloud;
     vector< MapSource* > allsources;
 
+    GetGridDensityPtr()->BuildSourceTree();
+
     int i;
     for ( i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
     {
@@ -777,40 +781,128 @@ void CfdMeshMgrSingleton::Remesh( int output_type )
     char str[256];
     int total_num_tris = 0;
     int nsurf = ( int )m_SurfVec.size();
+
+    //==== Border Nodes Are Fixed By The Chains - Each Surface Mesh Is Independent ====//
+    // Largest meshes first so dynamic scheduling does not leave one big surface for last.
+    vector < pair < int, int > > work_vec( nsurf );
     for ( int i = 0 ; i < nsurf ; ++i )
     {
+        work_vec[i] = make_pair( -m_SurfVec[i]->GetMesh()->GetNumFaces(), i );
+    }
+    stable_sort( work_vec.begin(), work_vec.end() );
+
+    vector < int > num_tris_vec( nsurf, 0 );
+
+    // A surface has converged once an iteration changes fewer than this fraction of its
+    // tris and no longer reduces the mean edge length error by more than 1%.
+    const int max_remesh_iter = 10;
+    const double converge_change_frac = 0.001;
+    const double converge_err_ratio = 0.99;
+
+    //==== Surfaces Whose Remesh Inputs Match The Previous Run Reuse Its Result ====//
+    RemeshCache* cache = GetRemeshCache();
+    vector < RemeshInput > input_vec( cache ? nsurf : 0 );
+    int num_reused = 0;
+
+    #pragma omp parallel for schedule( dynamic ) reduction( + : num_reused )
+    for ( int k = 0 ; k < nsurf ; ++k )
+    {
+        int i = work_vec[k].second;
+        char buf[256];
+        string surf_str;
+
         int num_tris = 0;
 
         int num_rev_removed = 0;
 
-        for ( int iter = 0 ; iter < 10 ; ++iter )
+        if ( cache )
+        {
+            m_SurfVec[i]->GetRemeshInput( input_vec[i] );
+
+            const MeshSnapshot* snap = cache->Find( input_vec[i] );
+            if ( snap )
+            {
+                m_SurfVec[i]->GetMesh()->LoadSnapshot( *snap );
+                num_tris_vec[i] = m_SurfVec[i]->GetMesh()->GetNumFaces();
+                num_reused++;
+
+                if ( output_type != CfdMeshMgrSingleton::QUIET_OUTPUT )
+                {
+                    snprintf( buf, sizeof( buf ), "Surf %3d/%3d Unchanged, reused Num Tris = %8d %s\n", i + 1, nsurf, num_tris_vec[i], m_SurfVec[i]->GetDisplayName().c_str() );
+                    #pragma omp critical( CfdMeshMgr_Remesh_Output )
+                    {
+                        addOutputText( buf, output_type );
+                    }
+                }
+                continue;
+            }
+        }
+
+        auto t0 = std::chrono::steady_clock::now();
+
+        //==== Remesh Until Topology Settles And Edge Length Error Stops Improving ====//
+        RemeshStats stats;
+        double prev_err = DBL_MAX;
+        bool converged = false;
+        int iter;
+        for ( iter = 0 ; iter < max_remesh_iter && !converged ; ++iter )
         {
             num_tris = 0;
-            m_SurfVec[i]->GetMesh()->Remesh();
+            stats = m_SurfVec[i]->GetMesh()->Remesh();
 
             num_rev_removed = m_SurfVec[ i ]->GetMesh()->RemoveRevFaces();
 
 
             num_tris += m_SurfVec[ i ]->GetMesh()->GetNumFaces();
 
-            snprintf( str, sizeof( str ), "Surf %3d/%3d Iter %2d/10 Num Tris = %8d %s\n", i + 1, nsurf, iter + 1, num_tris, m_SurfVec[i]->GetDisplayName().c_str() );
+            int num_changes = stats.NumTopoChanges() + num_rev_removed;
 
-            if ( output_type != CfdMeshMgrSingleton::QUIET_OUTPUT )
-            {
-                addOutputText( str, output_type );
-            }
+            snprintf( buf, sizeof( buf ), "Surf %3d/%3d Iter %2d/%d Num Tris = %8d Changes = %7d Len Err = %6.4f %s\n", i + 1, nsurf, iter + 1, max_remesh_iter,
+                      num_tris, num_changes, stats.m_LenError, m_SurfVec[i]->GetDisplayName().c_str() );
+            surf_str += buf;
+
+            converged = ( num_changes == 0 ) ||
+                        ( num_changes <= converge_change_frac * num_tris && stats.m_LenError >= converge_err_ratio * prev_err );
+            prev_err = stats.m_LenError;
         }
-        total_num_tris += num_tris;
+        num_tris_vec[i] = num_tris;
+
+        double elapsed = std::chrono::duration_cast< std::chrono::microseconds >( std::chrono::steady_clock::now() - t0 ).count() / 1.0e6;
+        snprintf( buf, sizeof( buf ), "Surf %3d/%3d %s after %2d iters, %8.3f s, %d edges off target\n", i + 1, nsurf, converged ? "converged" : "stopped", iter, elapsed, stats.m_NumBadEdges );
+        surf_str += buf;
 
         if ( num_rev_removed > 0 )
         {
-            snprintf( str, sizeof( str ), "%d Reversed tris collapsed in final iteration.\n", num_rev_removed );
-            if ( output_type != CfdMeshMgrSingleton::QUIET_OUTPUT )
+            snprintf( buf, sizeof( buf ), "%d Reversed tris collapsed in final iteration.\n", num_rev_removed );
+            surf_str += buf;
+        }
+        m_SurfVec[i]->GetMesh()->DumpGarbage();
+
+        //==== Report Each Surface As A Block Once It Finishes ====//
+        if ( output_type != CfdMeshMgrSingleton::QUIET_OUTPUT )
+        {
+            #pragma omp critical( CfdMeshMgr_Remesh_Output )
             {
-                addOutputText( str, output_type );
+                addOutputText( surf_str, output_type );
             }
         }
-        m_SurfVec[i]->GetMesh()->DumpGarbage();
+    }
+
+    for ( int i = 0 ; i < nsurf ; ++i )
+    {
+        total_num_tris += num_tris_vec[i];
+    }
+
+    if ( cache )
+    {
+        for ( int i = 0 ; i < nsurf ; ++i )
+        {
+            cache->Store( input_vec[i], m_SurfVec[i]->GetMesh() );
+        }
+        cache->FinishRun( num_reused );
+
+        snprintf( str, sizeof( str ), "Reused %d of %d surface meshes\n", num_reused, nsurf );
+        addOutputText( str, output_type );
     }
 
     WakeMgr.StretchWakes();
@@ -2915,34 +3007,54 @@ void CfdMeshMgrSingleton::RemoveInteriorTris()
     }
     double x_dist = 1.0 + big_box.GetMax( 0 ) - big_box.GetMin( 0 );
 
+    //==== Surface And Patch Box Trees - Rays Only Visit Surfaces And Patches They Overlap ====//
+    vector< BndBox > surf_box_vec( m_SurfVec.size() );
+    for ( s = 0 ; s < ( int )m_SurfVec.size() ; ++s )
+    {
+        surf_box_vec[s] = m_SurfVec[s]->GetBBox();
+        m_SurfVec[s]->BuildPatchTree();
+    }
+    BndBoxTree surf_tree;
+    surf_tree.Build( surf_box_vec );
+
+    int nsize = m_NumComps + 6;
+    if ( GetSettingsPtr()->m_SymSplittingOnFlag )
+    {
+        nsize = m_NumComps + 10;  // + 10 to handle possibility of outer domain and symmetry plane.
+    }
+
     //==== Count Number of Component Crossings for Each Component =====//
     list< Face* >::iterator f;
     for ( s = 0 ; s < ( int )m_SurfVec.size() ; ++s ) // every surface
     {
         int s_comp_id = m_SurfVec[s]->GetCompID();
         list <Face*> faceList = m_SurfVec[ s ]->GetMesh()->GetFaceList();
-        for ( f = faceList.begin() ; f != faceList.end(); ++f ) // every triangle
+        vector< Face* > face_vec( faceList.begin(), faceList.end() );
+
+        //==== Each Ray Only Reads Surfaces And Writes Its Own Face ====//
+        #pragma omp parallel for schedule( dynamic, 64 )
+        for ( int k = 0 ; k < ( int )face_vec.size() ; k++ ) // every triangle
         {
-            vector< vector< double > > t_vec_vec;
+            Face* face = face_vec[k];
 
-            if ( GetSettingsPtr()->m_SymSplittingOnFlag )
-            {
-                t_vec_vec.resize( m_NumComps + 10 );  // + 10 to handle possibility of outer domain and symmetry plane.
-                ( *f )->insideSurf.resize( m_NumComps + 10);
-                ( *f )->insideCount.resize( m_NumComps + 10);
-            }
-            else
-            {
-                t_vec_vec.resize( m_NumComps + 6 );
-                ( *f )->insideSurf.resize( m_NumComps + 6);
-                ( *f )->insideCount.resize( m_NumComps + 6);
-            }
+            vector< vector< double > > t_vec_vec( nsize );
+            face->insideSurf.resize( nsize );
+            face->insideCount.resize( nsize );
 
-            vec3d cp = ( *f )->ComputeCenterPnt( m_SurfVec[s] );
+            vec3d cp = face->ComputeCenterPnt( m_SurfVec[s] );
             vec3d ep = cp + vec3d( x_dist, 1.0e-4, 1.0e-4 );
 
-            for ( int i = 0 ; i < ( int )m_SurfVec.size() ; ++i )
+            BndBox line_box;
+            line_box.Update( cp );
+            line_box.Update( ep );
+
+            vector< int > surf_ids;
+            surf_tree.FindOverlaps( line_box, surf_ids );
+            sort( surf_ids.begin(), surf_ids.end() );
+
+            for ( int j = 0 ; j < ( int )surf_ids.size() ; ++j )
             {
+                int i = surf_ids[j];
                 int comp_id = m_SurfVec[i]->GetCompID();
                 if ( i != s && comp_id != s_comp_id ) // Don't check self intersection.
                 {
@@ -2966,14 +3078,14 @@ void CfdMeshMgrSingleton::RemoveInteriorTris()
             {
                 int c = m_SurfVec[i]->GetCompID();
 
-                if ( c >= 0 && c < ( *f )->insideSurf.size() )
+                if ( c >= 0 && c < face->insideSurf.size() )
                 {
                     if ( m_SurfVec[s]->GetSymPlaneFlag() && m_SurfVec[i]->GetFarFlag() &&
                          GetSettingsPtr()->m_FarCompFlag )
                     {
                         if ( ( int )( t_vec_vec[c].size() + 1 ) % 2 == 1 ) // +1 Reverse action on sym plane wrt outer boundary.
                         {
-                            ( *f )->insideSurf[c] = true;
+                            face->insideSurf[c] = true;
                         }
                     }
                     else
@@ -2981,7 +3093,7 @@ void CfdMeshMgrSingleton::RemoveInteriorTris()
 
                         if ( ( int )t_vec_vec[c].size() % 2 == 1)
                         {
-                            ( *f )->insideSurf[c] = true;
+                            face->insideSurf[c] = true;
                         }
                     }
                 }
@@ -3847,7 +3959,13 @@ void CfdMeshMgrSingleton::UpdateBBoxDOSymSplit( BndBox box )
 
 void CfdMeshMgrSingleton::SubTagTris()
 {
-    SubSurfaceMgr.ClearTagMaps();
+    m_TagCombos.clear();
+    m_TagNames.clear();
+    m_TagIDs.clear();
+    m_CompNames.clear();
+    m_CompIDs.clear();
+    m_ThickMap.clear();
+
     map< string, int > tag_map;
     map< string, set<int> > geom_comp_map;
     map< int, int >  comp_num_map; // map from an unmerged component number to the surface number of geom
@@ -3936,8 +4054,8 @@ void CfdMeshMgrSingleton::SubTagTris()
                                                  + "_Wake";
             }
 
-            SubSurfaceMgr.m_CompNames.push_back(name);
-            SubSurfaceMgr.m_CompIDs.push_back(exportid);
+            m_CompNames.push_back(name);
+            m_CompIDs.push_back(exportid);
 
             // Set to thin.
             bool thick = false;
@@ -3945,7 +4063,7 @@ void CfdMeshMgrSingleton::SubTagTris()
             {
                 thick = true;
             }
-            SubSurfaceMgr.m_ThickMap[ geom_id ] = thick;
+            m_ThickMap[ geom_id ] = thick;
         }
 
         surf->SetBaseTag( tag_map[id] );
@@ -3953,8 +4071,6 @@ void CfdMeshMgrSingleton::SubTagTris()
     }
 
     SetSimpSubSurfTags( tag_number );
-    SubSurfaceMgr.BuildCompNameMap();
-    SubSurfaceMgr.BuildCompIDMap();
 }
 
 void CfdMeshMgrSingleton::SetSimpSubSurfTags( int tag_offset )
@@ -3965,8 +4081,8 @@ void CfdMeshMgrSingleton::SetSimpSubSurfTags( int tag_offset )
     {
         m_SimpleSubSurfaceVec[i].m_Tag = tag_offset + i + 1;
         // map tag number to surface name
-        SubSurfaceMgr.m_TagNames[m_SimpleSubSurfaceVec[i].m_Tag] = m_SimpleSubSurfaceVec[i].GetName();
-        SubSurfaceMgr.m_TagIDs[m_SimpleSubSurfaceVec[i].m_Tag] = m_SimpleSubSurfaceVec[i].GetSSID();
+        m_TagNames[m_SimpleSubSurfaceVec[i].m_Tag] = m_SimpleSubSurfaceVec[i].GetName();
+        m_TagIDs[m_SimpleSubSurfaceVec[i].m_Tag] = m_SimpleSubSurfaceVec[i].GetSSID();
     }
 }
 
@@ -3999,10 +4115,27 @@ void CfdMeshMgrSingleton::Subtag( Surf* surf )
                 face.m_Tags.push_back( simp_s_surfs[s].m_Tag );
             }
         }
-        SubSurfaceMgr.m_TagCombos.insert( face.m_Tags );
+        m_TagCombos.insert( face.m_Tags );
     }
 }
 
+//==== Replace the SubSurfaceMgr Tag Maps With This Mesh's ====//
+void CfdMeshMgrSingleton::UpdateSubSurfTagMaps()
+{
+    SubSurfaceMgr.ClearTagMaps();
+
+    SubSurfaceMgr.m_TagCombos = m_TagCombos;
+    SubSurfaceMgr.m_TagNames = m_TagNames;
+    SubSurfaceMgr.m_TagIDs = m_TagIDs;
+    SubSurfaceMgr.m_CompNames = m_CompNames;
+    SubSurfaceMgr.m_CompIDs = m_CompIDs;
+    SubSurfaceMgr.m_ThickMap = m_ThickMap;
+
+    SubSurfaceMgr.BuildCompNameMap();
+    SubSurfaceMgr.BuildCompIDMap();
+    SubSurfaceMgr.BuildSingleTagMap();
+}
+
 void CfdMeshMgrSingleton::FindDegenCorners()
 {
     double tol = 1e-8;
@@ -21,7 +21,7 @@
 //              Match SCurves to create ICurves.  Create wakes surfs.
 //
 //  Intersect: Intersect all surfaces.  Intersect Y Slice Plane.
-//      Surf::Intersect - subdivide in to patches, keep splitting till planer, intersect.
+//      Surf::IntersectPatch - for patch pairs from the BVH broad phase, keep splitting till planer, intersect.
 //          CfdMeshMgr::AddIntersectionSeg - Create intersection points and segments.
 //
 //      CfdMeshMgr::LoadBorderCurves: Tesselate border curves, build border chains.
@@ -169,6 +169,9 @@ public:
     enum { QUIET_OUTPUT, VOCAL_OUTPUT, };
     virtual void Remesh( int output_type );
 
+    // Surface meshes kept from the previous Remesh, or NULL to remesh every surface
+    virtual RemeshCache* GetRemeshCache()                   { return NULL; }
+
     virtual void PostMesh();
 
     virtual void ConvertToQuads();
@@ -200,6 +203,7 @@ public:
     virtual void SubTagTris();
     virtual void SetSimpSubSurfTags( int tag_offset );
     virtual void Subtag( Surf* surf );
+    virtual void UpdateSubSurfTagMaps();
 
     virtual bool SetDeleteTriFlag( int aType, bool symPlane, vector < bool > aInB );
 
@@ -241,6 +245,14 @@ protected:
     vector< IPnt* > m_DegenCorners;
     vector< ISegChain* > m_DegenCornerChains;
 
+    // Tag maps built while meshing, copied to SubSurfaceMgr by UpdateSubSurfTagMaps()
+    set< vector< int > > m_TagCombos;
+    map< int, string > m_TagNames;
+    map< int, string > m_TagIDs;
+    vector< string > m_CompNames;
+    vector< string > m_CompIDs;
+    map< string, int > m_ThickMap;
+
 private:
     DrawObj m_MeshBadEdgeDO;
     DrawObj m_MeshBadTriDO;
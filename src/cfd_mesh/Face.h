@@ -85,7 +85,7 @@ public:
         n0 = n1 = NULL;
         f0 = f1 = NULL;
         ns = NULL;
-        ridge = border = debugFlag = m_DeleteMeFlag = false;
+        ridge = border = debugFlag = m_DeleteMeFlag = m_QueuedFlag = false;
         target_len = 0;
         m_Length = 0;
     }
@@ -95,7 +95,7 @@ public:
         n1 = node1;
         ns = NULL;
         f0 = f1 = NULL;
-        ridge = border = debugFlag = m_DeleteMeFlag = false;
+        ridge = border = debugFlag = m_DeleteMeFlag = m_QueuedFlag = false;
         target_len = 0;
         m_Length = 0;
     }
@@ -104,6 +104,7 @@ public:
     list< Edge* >::iterator list_ptr;
 
     bool m_DeleteMeFlag;
+    bool m_QueuedFlag;      // In the Mesh::Remesh work queue
 
     Node* n0;
     Node* n1;
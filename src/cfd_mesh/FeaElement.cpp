@@ -79,6 +79,25 @@ void FeaNode::WriteNASTRAN( FILE* fp, long long int noffset, bool includeBC )
     fprintf( fp, fmt.c_str(), m_Index + noffset, x, y, z, bcstr.c_str() );
 }
 
+void FeaNode::WriteNASTRAN( FormatBuffer & buf, long long int noffset, bool includeBC )
+{
+    buf.Append( "GRID    ," );
+    buf.AppendInt( m_Index + noffset, 8 );
+    buf.Append( ",        ," );
+    buf.AppendNas( m_Pnt.x() );
+    buf.Append( ',' );
+    buf.AppendNas( m_Pnt.y() );
+    buf.Append( ',' );
+    buf.AppendNas( m_Pnt.z() );
+    buf.Append( ",        ," );
+
+    if ( includeBC )
+    {
+        buf.Append( m_BCs.AsNASTRAN() );
+    }
+    buf.Append( '\n' );
+}
+
 void FeaNode::WriteNASTRAN_SPC1( FILE* fp, long long int noffset )
 {
     if ( m_BCs.AsNum() > 0 )
@@ -106,6 +125,18 @@ void FeaNode::WriteCalculix( FILE* fp, long long int noffset )
     }
 }
 
+void FeaNode::WriteCalculix( FormatBuffer & buf, long long int noffset )
+{
+    buf.AppendInt( m_Index + noffset );
+    buf.Append( ',' );
+    buf.AppendFixed( m_Pnt.x() );
+    buf.Append( ',' );
+    buf.AppendFixed( m_Pnt.y() );
+    buf.Append( ',' );
+    buf.AppendFixed( m_Pnt.z() );
+    buf.Append( '\n' );
+}
+
 void FeaNode::WriteCalculixBCs( FILE* fp, long long int noffset )
 {
     int ndof = 6;
@@ -129,6 +160,16 @@ void FeaNode::WriteGmsh( FILE* fp, long long int noffset )
 //================== FeaElement ====================//
 //////////////////////////////////////////////////////
 
+//==== Append Comma Separated Node Indices ====//
+static void AppendNodeIndices( FormatBuffer & buf, const vector< FeaNode* > & nodes, long long int noffset, int width = 0 )
+{
+    for ( int i = 0; i < (int)nodes.size(); i++ )
+    {
+        buf.Append( ',' );
+        buf.AppendInt( nodes[i]->GetIndex() + noffset, width );
+    }
+}
+
 FeaElement::FeaElement()
 {
     m_ElementType = FEA_TRI_6;
@@ -165,6 +206,25 @@ void FeaElement::LoadNodes( vector< FeaNode* > & node_vec )
     }
 }
 
+double FeaElement::ComputeThetaMaterial()
+{
+    vec3d v01 = m_Corners[1]->m_Pnt - m_Corners[0]->m_Pnt;
+    vec3d v12 = m_Corners[2]->m_Pnt - m_Corners[1]->m_Pnt;
+    v01.normalize();
+    v12.normalize();
+    vec3d norm = cross( v01, v12);
+    norm.normalize();
+
+    double theta_material = RAD_2_DEG * signed_angle( v01, m_Orientation, norm );
+
+    if ( theta_material < 0 )
+    {
+        theta_material += 180.0;
+    }
+
+    return theta_material;
+}
+
 //////////////////////////////////////////////////////
 //==================== FeaTri ======================//
 //////////////////////////////////////////////////////
@@ -211,19 +271,7 @@ void FeaTri::WriteCalculix( FILE* fp, int id, long long int noffset, long long i
 
 void FeaTri::WriteNASTRAN( FILE* fp, int id, int property_index, long long int noffset, long long int eoffset )
 {
-    vec3d v01 = m_Corners[1]->m_Pnt - m_Corners[0]->m_Pnt;
-    vec3d v12 = m_Corners[2]->m_Pnt - m_Corners[1]->m_Pnt;
-    v01.normalize();
-    v12.normalize();
-    vec3d norm = cross( v01, v12);
-    norm.normalize();
-
-    double theta_material = RAD_2_DEG * signed_angle( v01, m_Orientation, norm );
-
-    if ( theta_material < 0 )
-    {
-        theta_material += 180.0;
-    }
+    double theta_material = ComputeThetaMaterial();
 
 
     if ( m_ElementType == FEA_TRI_3 )
@@ -244,6 +292,44 @@ void FeaTri::WriteNASTRAN( FILE* fp, int id, int property_index, long long int n
     }
 }
 
+void FeaTri::WriteCalculix( FormatBuffer & buf, int id, long long int noffset, long long int eoffset )
+{
+    buf.AppendInt( id + eoffset );
+    AppendNodeIndices( buf, m_Corners, noffset );
+    if ( m_ElementType != FEA_TRI_3 )
+    {
+        AppendNodeIndices( buf, m_Mids, noffset );
+    }
+    buf.Append( '\n' );
+}
+
+void FeaTri::WriteNASTRAN( FormatBuffer & buf, int id, int property_index, long long int noffset, long long int eoffset )
+{
+    double theta_material = ComputeThetaMaterial();
+
+    if ( m_ElementType == FEA_TRI_3 )
+    {
+        buf.Append( "CTRIA3  ," );
+    }
+    else
+    {
+        buf.Append( "CTRIA6  ," );
+    }
+    buf.AppendInt( id + eoffset, 8 );
+    buf.Append( ',' );
+    buf.AppendInt( property_index + 1, 8 );
+    AppendNodeIndices( buf, m_Corners, noffset, 8 );
+
+    if ( m_ElementType != FEA_TRI_3 )
+    {
+        AppendNodeIndices( buf, m_Mids, noffset, 8 );
+        buf.Append( ",\n        " );
+    }
+    buf.Append( ',' );
+    buf.AppendNas( theta_material );
+    buf.Append( '\n' );
+}
+
 void FeaTri::WriteGmsh( FILE* fp, int id, int fea_part_index, long long int noffset, long long int eoffset )
 {
     if ( m_ElementType == FEA_TRI_3 )
@@ -364,19 +450,7 @@ void FeaQuad::WriteCalculix( FILE* fp, int id, long long int noffset, long long
 }
 void FeaQuad::WriteNASTRAN( FILE* fp, int id, int property_index, long long int noffset, long long int eoffset )
 {
-    vec3d v01 = m_Corners[1]->m_Pnt - m_Corners[0]->m_Pnt;
-    vec3d v12 = m_Corners[2]->m_Pnt - m_Corners[1]->m_Pnt;
-    v01.normalize();
-    v12.normalize();
-    vec3d norm = cross( v01, v12);
-    norm.normalize();
-
-    double theta_material = RAD_2_DEG * signed_angle( v01, m_Orientation, norm );
-
-    if ( theta_material < 0 )
-    {
-        theta_material += 180.0;
-    }
+    double theta_material = ComputeThetaMaterial();
 
     if ( m_ElementType == FEA_QUAD_4 )
     {
@@ -396,6 +470,49 @@ void FeaQuad::WriteNASTRAN( FILE* fp, int id, int property_index, long long int
     }
 }
 
+void FeaQuad::WriteCalculix( FormatBuffer & buf, int id, long long int noffset, long long int eoffset )
+{
+    buf.AppendInt( id + eoffset );
+    AppendNodeIndices( buf, m_Corners, noffset );
+    if ( m_ElementType != FEA_QUAD_4 )
+    {
+        AppendNodeIndices( buf, m_Mids, noffset );
+    }
+    buf.Append( '\n' );
+}
+
+void FeaQuad::WriteNASTRAN( FormatBuffer & buf, int id, int property_index, long long int noffset, long long int eoffset )
+{
+    double theta_material = ComputeThetaMaterial();
+
+    if ( m_ElementType == FEA_QUAD_4 )
+    {
+        buf.Append( "CQUAD4  ," );
+    }
+    else
+    {
+        buf.Append( "CQUAD8  ," );
+    }
+    buf.AppendInt( id + eoffset, 8 );
+    buf.Append( ',' );
+    buf.AppendInt( property_index + 1, 8 );
+    AppendNodeIndices( buf, m_Corners, noffset, 8 );
+
+    if ( m_ElementType != FEA_QUAD_4 )
+    {
+        // Continuation line after the first two mid nodes
+        for ( int i = 0; i < 4; i++ )
+        {
+            buf.Append( i == 2 ? ",\n        ," : "," );
+            buf.AppendInt( m_Mids[i]->GetIndex() + noffset, 8 );
+        }
+        buf.Append( ",        ,        ,        ,        " );
+    }
+    buf.Append( ',' );
+    buf.AppendNas( theta_material );
+    buf.Append( '\n' );
+}
+
 void FeaQuad::WriteGmsh( FILE* fp, int id, int fea_part_index, long long int noffset, long long int eoffset )
 {
     if ( m_ElementType == FEA_QUAD_4 )
@@ -538,6 +655,60 @@ void FeaBeam::WriteNASTRAN( FILE* fp, int id, int property_index, long long int
              m_Corners[1]->GetIndex() + noffset, m_Norm0.x(), m_Norm0.y(), m_Norm0.z() );
 }
 
+void FeaBeam::WriteCalculix( FormatBuffer & buf, int id, long long int noffset, long long int eoffset )
+{
+    buf.AppendInt( id + eoffset );
+    buf.Append( ',' );
+    buf.AppendInt( m_Corners[0]->GetIndex() + noffset );
+    buf.Append( ',' );
+    buf.AppendInt( m_Mids[0]->GetIndex() + noffset );
+    buf.Append( ',' );
+    buf.AppendInt( m_Corners[1]->GetIndex() + noffset );
+    buf.Append( '\n' );
+
+    m_ElementIndex = id; // Save element index
+}
+
+void FeaBeam::WriteCalculixNormal( FormatBuffer & buf, long long int noffset, long long int eoffset )
+{
+    vec3d norm = ( m_Norm0 + m_Norm1 ) * 0.5;
+    norm.normalize();
+
+    FeaNode* nodes[3] = { m_Corners[0], m_Mids[0], m_Corners[1] };
+    vec3d norms[3] = { m_Norm0, norm, m_Norm1 };
+
+    for ( int i = 0; i < 3; i++ )
+    {
+        buf.AppendInt( m_ElementIndex + eoffset );
+        buf.Append( ',' );
+        buf.AppendInt( nodes[i]->GetIndex() + noffset );
+        for ( int j = 0; j < 3; j++ )
+        {
+            buf.Append( ',' );
+            buf.AppendFixed( norms[i][j] );
+        }
+        buf.Append( '\n' );
+    }
+}
+
+void FeaBeam::WriteNASTRAN( FormatBuffer & buf, int id, int property_index, long long int noffset, long long int eoffset )
+{
+    buf.Append( "CBAR    ," );
+    buf.AppendInt( id + eoffset, 8 );
+    buf.Append( ',' );
+    buf.AppendInt( property_index + 1, 8 );
+    buf.Append( ',' );
+    buf.AppendInt( m_Corners[0]->GetIndex() + noffset, 8 );
+    buf.Append( ',' );
+    buf.AppendInt( m_Corners[1]->GetIndex() + noffset, 8 );
+    for ( int j = 0; j < 3; j++ )
+    {
+        buf.Append( ',' );
+        buf.AppendNas( m_Norm0[j] );
+    }
+    buf.Append( '\n' );
+}
+
 void FeaBeam::WriteGmsh( FILE* fp, int id, int fea_part_index, long long int noffset, long long int eoffset )
 {
     // 2 node line line (1)
@@ -609,6 +780,26 @@ void FeaPointMass::WriteNASTRAN( FILE* fp, int id, int property_index, long long
     fprintf( fp, format_string.c_str(), id + eoffset, m_Corners[0]->GetIndex() + noffset, m_Mass );
 }
 
+void FeaPointMass::WriteCalculix( FormatBuffer & buf, int id, long long int noffset, long long int eoffset )
+{
+    buf.AppendInt( id + eoffset );
+    buf.Append( ',' );
+    buf.AppendInt( m_Corners[0]->GetIndex() + noffset );
+    buf.Append( '\n' );
+}
+
+void FeaPointMass::WriteNASTRAN( FormatBuffer & buf, int id, int property_index, long long int noffset, long long int eoffset )
+{
+    // Note: property_index ignored
+    buf.Append( "CONM2   ," );
+    buf.AppendInt( id + eoffset, 8 );
+    buf.Append( ',' );
+    buf.AppendInt( m_Corners[0]->GetIndex() + noffset, 8 );
+    buf.Append( ",        ," );
+    buf.AppendNas( m_Mass );
+    buf.Append( '\n' );
+}
+
 //////////////////////////////////////////////////////
 //=============== SimpleFeaProperty ================//
 //////////////////////////////////////////////////////
@@ -18,6 +18,7 @@
 #include "Vec3d.h"
 #include "FeaStructure.h"
 #include "BitMask.h"
+#include "FormatBuffer.h"
 
 using namespace std;
 
@@ -50,8 +51,10 @@ public:
     vector< int > m_Tags;
 
     void WriteNASTRAN( FILE* fp, long long int noffset, bool includeBC = false );
+    void WriteNASTRAN( FormatBuffer & buf, long long int noffset, bool includeBC = false );
     void WriteNASTRAN_SPC1( FILE* fp, long long int noffset );
     void WriteCalculix( FILE* fp, long long int noffset );
+    void WriteCalculix( FormatBuffer & buf, long long int noffset );
     void WriteCalculixBCs( FILE* fp, long long int noffset );
     void WriteGmsh( FILE* fp, long long int noffset );
 };
@@ -96,6 +99,8 @@ public:
 
     virtual void WriteCalculix( FILE* fp, int id, long long int noffset, long long int eoffset ) = 0;
     virtual void WriteNASTRAN( FILE* fp, int id, int property_index, long long int noffset, long long int eoffset ) = 0;
+    virtual void WriteCalculix( FormatBuffer & buf, int id, long long int noffset, long long int eoffset ) = 0;
+    virtual void WriteNASTRAN( FormatBuffer & buf, int id, int property_index, long long int noffset, long long int eoffset ) = 0;
     virtual void WriteGmsh( FILE* fp, int id, int fea_part_index, long long int noffset, long long int eoffset ) = 0;
     virtual void WriteSTL( FILE* fp ) = 0;
     virtual double ComputeMass( int property_index ) = 0;
@@ -119,6 +124,8 @@ public:
     vec3d m_Orientation;
 protected:
 
+    virtual double ComputeThetaMaterial();
+
     int m_ElementType;
     int m_FeaPartIndex; // Corresponds to index in FeaStructure m_FeaPartVec
     int m_FeaSSIndex; // Corresponds to index in FeaStructure m_FeaSubSurfVec
@@ -136,6 +143,8 @@ public:
     virtual void Create( vec3d & p0, vec3d & p1, vec3d & p2, bool highorder );
     virtual void WriteCalculix( FILE* fp, int id, long long int noffset, long long int eoffset );
     virtual void WriteNASTRAN( FILE* fp, int id, int property_index, long long int noffset, long long int eoffset );
+    virtual void WriteCalculix( FormatBuffer & buf, int id, long long int noffset, long long int eoffset );
+    virtual void WriteNASTRAN( FormatBuffer & buf, int id, int property_index, long long int noffset, long long int eoffset );
     virtual void WriteGmsh( FILE* fp, int id, int fea_part_index, long long int noffset, long long int eoffset );
     virtual void WriteSTL( FILE* fp );
     virtual double ComputeMass( int property_index );
@@ -151,6 +160,8 @@ public:
     virtual void Create( vec3d & p0, vec3d & p1, vec3d & p2, vec3d & p3, bool highorder );
     virtual void WriteCalculix( FILE* fp, int id, long long int noffset, long long int eoffset );
     virtual void WriteNASTRAN( FILE* fp, int id, int property_index, long long int noffset, long long int eoffset );
+    virtual void WriteCalculix( FormatBuffer & buf, int id, long long int noffset, long long int eoffset );
+    virtual void WriteNASTRAN( FormatBuffer & buf, int id, int property_index, long long int noffset, long long int eoffset );
     virtual void WriteGmsh( FILE* fp, int id, int fea_part_index, long long int noffset, long long int eoffset );
     virtual void WriteSTL( FILE* fp );
     virtual double ComputeMass( int property_index );
@@ -168,6 +179,9 @@ public:
     virtual void WriteCalculixNormal( FILE* fp, long long int noffset, long long int eoffset );
     virtual void WriteCalculixNormal( FILE* fp );
     virtual void WriteNASTRAN( FILE* fp, int id, int property_index, long long int noffset, long long int eoffset );
+    virtual void WriteCalculix( FormatBuffer & buf, int id, long long int noffset, long long int eoffset );
+    virtual void WriteCalculixNormal( FormatBuffer & buf, long long int noffset, long long int eoffset );
+    virtual void WriteNASTRAN( FormatBuffer & buf, int id, int property_index, long long int noffset, long long int eoffset );
     virtual void WriteGmsh( FILE* fp, int id, int fea_part_index, long long int noffset, long long int eoffset );
     virtual void WriteSTL( FILE* fp ) {};
     virtual double ComputeMass( int property_index );
@@ -190,6 +204,8 @@ public:
     virtual void Create( vec3d & p0, double mass );
     virtual void WriteCalculix( FILE* fp, int id, long long int noffset, long long int eoffset );
     virtual void WriteNASTRAN( FILE* fp, int id, int property_index, long long int noffset, long long int eoffset );
+    virtual void WriteCalculix( FormatBuffer & buf, int id, long long int noffset, long long int eoffset );
+    virtual void WriteNASTRAN( FormatBuffer & buf, int id, int property_index, long long int noffset, long long int eoffset );
     virtual void WriteGmsh( FILE* fp, int id, int fea_part_index, long long int noffset, long long int eoffset )    {};
     virtual void WriteSTL( FILE* fp ) {};
     virtual double ComputeMass( int property_index )
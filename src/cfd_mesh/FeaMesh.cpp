@@ -952,6 +952,7 @@ void FeaMesh::WriteNASTRANNodes( FILE* dat_fp, FILE* bdf_fp, FILE* nkey_fp, int
     if ( dat_fp && bdf_fp )
     {
         vector < long long int > node_id_vec;
+        vector < FeaNode* > node_vec;
         string name;
 
         //==== Write Fixed Points ====//
@@ -983,33 +984,26 @@ void FeaMesh::WriteNASTRANNodes( FILE* dat_fp, FILE* bdf_fp, FILE* nkey_fp, int
         // FeaPart Nodes
         for ( unsigned int i = 0; i < m_NumFeaParts; i++ )
         {
-            node_id_vec.clear();
-
-            bool partheader = false;
+            node_vec.clear();
 
             if ( m_FeaPartTypeVec[i] != vsp::FEA_FIX_POINT )
             {
                 for ( unsigned int j = 0; j < (int)m_FeaNodeVec.size(); j++ )
                 {
-                    if ( m_FeaNodeVecUsed[ j ] )
+                    if ( m_FeaNodeVecUsed[ j ] && m_FeaNodeVec[ j ]->HasOnlyTag( i ) )
                     {
-                        if ( m_FeaNodeVec[ j ]->HasOnlyTag( i ) )
-                        {
-                            if ( !partheader )
-                            {
-                                partheader = true;
-
-                                fprintf( bdf_fp, "\n" );
-                                fprintf( bdf_fp, "$ %s %s Gridpoints\n", m_FeaPartNameVec[i].c_str(), m_StructName.c_str() );
-                            }
-
-                            m_FeaNodeVec[j]->WriteNASTRAN( bdf_fp, noffset );
-                            node_id_vec.push_back( m_FeaNodeVec[j]->m_Index );
-                        }
+                        node_vec.push_back( m_FeaNodeVec[ j ] );
                     }
                 }
             }
 
+            if ( !node_vec.empty() )
+            {
+                fprintf( bdf_fp, "\n" );
+                fprintf( bdf_fp, "$ %s %s Gridpoints\n", m_FeaPartNameVec[i].c_str(), m_StructName.c_str() );
+            }
+            WriteNASTRANNodeBlock( bdf_fp, node_vec, node_id_vec );
+
             // Write FEA part node set
             name = m_FeaPartNameVec[i] + "_" + m_StructName + "_Gridpoints";
             WriteNASTRANSet( dat_fp, nkey_fp, set_cnt, node_id_vec, name, noffset );
@@ -1018,87 +1012,88 @@ void FeaMesh::WriteNASTRANNodes( FILE* dat_fp, FILE* bdf_fp, FILE* nkey_fp, int
         // SubSurface Nodes
         for ( unsigned int i = 0; i < m_NumFeaSubSurfs; i++ )
         {
-            bool ssheader = false;
-
-            node_id_vec.clear();
+            node_vec.clear();
 
             for ( unsigned int j = 0; j < (int)m_FeaNodeVec.size(); j++ )
             {
-                if ( m_FeaNodeVecUsed[ j ] )
+                if ( m_FeaNodeVecUsed[ j ] && m_FeaNodeVec[ j ]->HasOnlyTag( i + m_NumFeaParts ) )
                 {
-                    if ( m_FeaNodeVec[ j ]->HasOnlyTag( i + m_NumFeaParts ) )
-                    {
-                        if ( !ssheader )
-                        {
-                            ssheader = true;
-
-                            fprintf( bdf_fp, "\n" );
-                            fprintf( bdf_fp, "$ %s %s Gridpoints\n", m_SimpleSubSurfaceVec[i].GetName().c_str(), m_StructName.c_str() );
-                        }
-                        m_FeaNodeVec[j]->WriteNASTRAN( bdf_fp, noffset );
-                        node_id_vec.push_back( m_FeaNodeVec[j]->m_Index );
-                    }
+                    node_vec.push_back( m_FeaNodeVec[ j ] );
                 }
             }
 
+            if ( !node_vec.empty() )
+            {
+                fprintf( bdf_fp, "\n" );
+                fprintf( bdf_fp, "$ %s %s Gridpoints\n", m_SimpleSubSurfaceVec[i].GetName().c_str(), m_StructName.c_str() );
+            }
+            WriteNASTRANNodeBlock( bdf_fp, node_vec, node_id_vec );
+
             // Write subsurface node set
             name = m_SimpleSubSurfaceVec[i].GetName() + "_" + m_StructName + "_Gridpoints";
             WriteNASTRANSet( dat_fp, nkey_fp, set_cnt, node_id_vec, name, noffset );
         }
 
-        node_id_vec.clear();
-
         // Intersection Nodes
-        bool IntersectHeader = false;
+        node_vec.clear();
         for ( unsigned int j = 0; j < (int)m_FeaNodeVec.size(); j++ )
         {
-            if ( m_FeaNodeVecUsed[ j ] )
+            if ( m_FeaNodeVecUsed[ j ] && m_FeaNodeVec[j]->m_Tags.size() > 1 && !m_FeaNodeVec[j]->m_FixedPointFlag )
             {
-                if ( m_FeaNodeVec[j]->m_Tags.size() > 1 && !m_FeaNodeVec[j]->m_FixedPointFlag )
-                {
-                    if ( !IntersectHeader )
-                    {
-                        fprintf( bdf_fp, "\n" );
-                        fprintf( bdf_fp, "$ %s Intersections\n", m_StructName.c_str() );
-                        IntersectHeader = true;
-                    }
-                    m_FeaNodeVec[j]->WriteNASTRAN( bdf_fp, noffset );
-                    node_id_vec.push_back( m_FeaNodeVec[j]->m_Index );
-                }
+                node_vec.push_back( m_FeaNodeVec[ j ] );
             }
         }
 
+        if ( !node_vec.empty() )
+        {
+            fprintf( bdf_fp, "\n" );
+            fprintf( bdf_fp, "$ %s Intersections\n", m_StructName.c_str() );
+        }
+        WriteNASTRANNodeBlock( bdf_fp, node_vec, node_id_vec );
+
         // Write intersection node set
         name = m_StructName + "_Intersection_Gridpoints";
         WriteNASTRANSet( dat_fp, nkey_fp, set_cnt, node_id_vec, name, noffset );
 
-        node_id_vec.clear();
-
         //==== Remaining Nodes ====//
-        bool RemainingHeader = false;
+        node_vec.clear();
         for ( int i = 0; i < (int)m_FeaNodeVec.size(); i++ )
         {
-            node_id_vec.clear();
-
             if ( m_FeaNodeVecUsed[ i ] && m_FeaNodeVec[i]->m_Tags.size() == 0 )
             {
-                if ( !RemainingHeader )
-                {
-                    fprintf( bdf_fp, "\n" );
-                    fprintf( bdf_fp, "$ %s Remainingnodes\n", m_StructName.c_str() );
-                    RemainingHeader = true;
-                }
-                m_FeaNodeVec[i]->WriteNASTRAN( bdf_fp, noffset );
-                node_id_vec.push_back( m_FeaNodeVec[i]->m_Index );
+                node_vec.push_back( m_FeaNodeVec[ i ] );
             }
         }
 
+        if ( !node_vec.empty() )
+        {
+            fprintf( bdf_fp, "\n" );
+            fprintf( bdf_fp, "$ %s Remainingnodes\n", m_StructName.c_str() );
+        }
+        WriteNASTRANNodeBlock( bdf_fp, node_vec, node_id_vec );
+
         // Write remaining node set
         name = m_StructName + "_Remaining_Gridpoints";
         WriteNASTRANSet( dat_fp, nkey_fp, set_cnt, node_id_vec, name, noffset );
     }
 }
 
+void FeaMesh::WriteNASTRANNodeBlock( FILE* bdf_fp, const vector < FeaNode* > &node_vec, vector < long long int > &node_id_vec )
+{
+    long long int noffset = m_StructSettings.m_NodeOffset;
+
+    node_id_vec.resize( node_vec.size() );
+    for ( size_t i = 0; i < node_vec.size(); i++ )
+    {
+        node_id_vec[i] = node_vec[i]->m_Index;
+    }
+
+    WriteRecords( bdf_fp, node_vec.size(), [&]( FormatBuffer & buf, size_t i )
+    {
+        node_vec[i]->WriteNASTRAN( buf, noffset );
+    } );
+}
+
 void FeaMesh::WriteNASTRANSPC1( FILE *bdf_fp )
 {
     unsigned long long int noffset = m_StructSettings.m_NodeOffset;
@@ -1237,13 +1232,13 @@ void FeaMesh::WriteNASTRANSPC1( FILE *bdf_fp )
 
 void FeaMesh::WriteNASTRANElements( FILE* dat_fp, FILE* bdf_fp, FILE* nkey_fp, int &set_cnt )
 {
-    unsigned long long int noffset = m_StructSettings.m_NodeOffset;
     unsigned long long int eoffset = m_StructSettings.m_ElementOffset;
 
     if ( dat_fp && bdf_fp )
     {
         string name;
         vector < long long int > shell_elem_id_vec, beam_elem_id_vec;
+        vector < FeaElement* > elem_vec;
         int elem_id = 1;
 
         // Write FeaFixPoints
@@ -1252,31 +1247,27 @@ void FeaMesh::WriteNASTRANElements( FILE* dat_fp, FILE* bdf_fp, FILE* nkey_fp, i
             FixPoint fxpt = m_FixPntVec[i];
             if ( fxpt.m_PtMassFlag )
             {
-                bool FPHeader = false;
-
-                vector < long long int > mass_elem_id_vec;
+                elem_vec.clear();
 
                 for ( int j = 0; j < m_FeaElementVec.size(); j++ )
                 {
                     if ( m_FeaElementVec[j]->GetElementType() == FeaElement::FEA_POINT_MASS && m_FeaElementVec[j]->GetFeaPartIndex() == fxpt.m_FeaPartIndex && m_FeaElementVec[j]->GetFeaSSIndex() < 0 )
                     {
-                        if ( !FPHeader )
-                        {
-                            FPHeader = true;
-
-                            fprintf( bdf_fp, "\n" );
-                            fprintf( bdf_fp, "$ %s %s\n", m_FeaPartNameVec[fxpt.m_FeaPartIndex].c_str(), m_StructName.c_str() );
-                        }
-
-                        m_FeaElementVec[j]->WriteNASTRAN( bdf_fp, elem_id, -1, noffset, eoffset ); // property ID ignored for Point Masses
-                        mass_elem_id_vec.push_back( elem_id );
-                        elem_id++;
+                        elem_vec.push_back( m_FeaElementVec[j] );
                     }
                 }
 
+                if ( !elem_vec.empty() )
+                {
+                    fprintf( bdf_fp, "\n" );
+                    fprintf( bdf_fp, "$ %s %s\n", m_FeaPartNameVec[fxpt.m_FeaPartIndex].c_str(), m_StructName.c_str() );
+                }
+                // property ID ignored for Point Masses
+                WriteNASTRANElementBlock( bdf_fp, elem_vec, elem_id, -1, -1, shell_elem_id_vec, beam_elem_id_vec );
+
                 // Write mass element set
                 name = m_FeaPartNameVec[fxpt.m_FeaPartIndex] + "_" +  m_StructName + "_MassElements";
-                WriteNASTRANSet( dat_fp, nkey_fp, set_cnt, mass_elem_id_vec, name, eoffset );
+                WriteNASTRANSet( dat_fp, nkey_fp, set_cnt, shell_elem_id_vec, name, eoffset );
             }
         }
 
@@ -1285,10 +1276,7 @@ void FeaMesh::WriteNASTRANElements( FILE* dat_fp, FILE* bdf_fp, FILE* nkey_fp, i
         {
             if ( m_FeaPartTypeVec[i] != vsp::FEA_FIX_POINT )
             {
-                bool partheader = false;
-
-                shell_elem_id_vec.clear();
-                beam_elem_id_vec.clear();
+                elem_vec.clear();
 
                 int property_id = m_FeaPartPropertyIndexVec[i];
                 int cap_property_id = m_FeaPartCapPropertyIndexVec[i];
@@ -1297,31 +1285,17 @@ void FeaMesh::WriteNASTRANElements( FILE* dat_fp, FILE* bdf_fp, FILE* nkey_fp, i
                 {
                     if ( m_FeaElementVec[j]->GetFeaPartIndex() == i && m_FeaElementVec[j]->GetFeaSSIndex() < 0 )
                     {
-                        if ( !partheader )
-                        {
-                            partheader = true;
-
-                            fprintf( bdf_fp, "\n" );
-                            fprintf( bdf_fp, "$ %s %s\n", m_FeaPartNameVec[i].c_str(), m_StructName.c_str()  );
-                        }
-
-                        if ( m_FeaElementVec[j]->GetElementType() != FeaElement::FEA_BEAM )
-                        {
-                            m_FeaElementVec[j]->WriteNASTRAN( bdf_fp, elem_id, property_id, noffset, eoffset );
-                            shell_elem_id_vec.push_back( elem_id );
-                            FeaMeshMgr.MarkPropMatUsed( property_id );
-                        }
-                        else
-                        {
-                            m_FeaElementVec[j]->WriteNASTRAN( bdf_fp, elem_id, cap_property_id, noffset, eoffset );
-                            beam_elem_id_vec.push_back( elem_id );
-                            FeaMeshMgr.MarkPropMatUsed( cap_property_id );
-                        }
-
-                        elem_id++;
+                        elem_vec.push_back( m_FeaElementVec[j] );
                     }
                 }
 
+                if ( !elem_vec.empty() )
+                {
+                    fprintf( bdf_fp, "\n" );
+                    fprintf( bdf_fp, "$ %s %s\n", m_FeaPartNameVec[i].c_str(), m_StructName.c_str()  );
+                }
+                WriteNASTRANElementBlock( bdf_fp, elem_vec, elem_id, property_id, cap_property_id, shell_elem_id_vec, beam_elem_id_vec );
+
                 // Write shell element set
                 name = m_FeaPartNameVec[i] + "_" + m_StructName + "_ShellElements";
                 WriteNASTRANSet( dat_fp, nkey_fp, set_cnt, shell_elem_id_vec, name, eoffset );
@@ -1335,43 +1309,26 @@ void FeaMesh::WriteNASTRANElements( FILE* dat_fp, FILE* bdf_fp, FILE* nkey_fp, i
         // Write FeaSubSurfaces
         for ( unsigned int i = 0; i < m_NumFeaSubSurfs; i++ )
         {
-            bool ssheader = false;
+            elem_vec.clear();
 
             int property_id = m_SimpleSubSurfaceVec[i].GetFeaPropertyIndex();
             int cap_property_id = m_SimpleSubSurfaceVec[i].GetCapFeaPropertyIndex();
 
-            shell_elem_id_vec.clear();
-            beam_elem_id_vec.clear();
-
             for ( int j = 0; j < m_FeaElementVec.size(); j++ )
             {
                 if ( m_FeaElementVec[j]->GetFeaSSIndex() == i )
                 {
-                    if ( !ssheader )
-                    {
-                        ssheader = true;
-
-                        fprintf( bdf_fp, "\n" );
-                        fprintf( bdf_fp, "$ %s %s\n", m_SimpleSubSurfaceVec[i].GetName().c_str(), m_StructName.c_str() );
-                    }
-
-                    if ( m_FeaElementVec[j]->GetElementType() != FeaElement::FEA_BEAM )
-                    {
-                        m_FeaElementVec[j]->WriteNASTRAN( bdf_fp, elem_id, property_id, noffset, eoffset );
-                        shell_elem_id_vec.push_back( elem_id );
-                        FeaMeshMgr.MarkPropMatUsed( property_id );
-                    }
-                    else
-                    {
-                        m_FeaElementVec[j]->WriteNASTRAN( bdf_fp, elem_id, cap_property_id, noffset, eoffset );
-                        beam_elem_id_vec.push_back( elem_id );
-                        FeaMeshMgr.MarkPropMatUsed( cap_property_id );
-                    }
-
-                    elem_id++;
+                    elem_vec.push_back( m_FeaElementVec[j] );
                 }
             }
 
+            if ( !elem_vec.empty() )
+            {
+                fprintf( bdf_fp, "\n" );
+                fprintf( bdf_fp, "$ %s %s\n", m_SimpleSubSurfaceVec[i].GetName().c_str(), m_StructName.c_str() );
+            }
+            WriteNASTRANElementBlock( bdf_fp, elem_vec, elem_id, property_id, cap_property_id, shell_elem_id_vec, beam_elem_id_vec );
+
             // Write shell element set
             name = m_SimpleSubSurfaceVec[i].GetName() + "_" + m_StructName + "_ShellElements";
             WriteNASTRANSet( dat_fp, nkey_fp, set_cnt, shell_elem_id_vec, name, eoffset );
@@ -1383,6 +1340,52 @@ void FeaMesh::WriteNASTRANElements( FILE* dat_fp, FILE* bdf_fp, FILE* nkey_fp, i
     }
 }
 
+void FeaMesh::WriteNASTRANElementBlock( FILE* bdf_fp, const vector < FeaElement* > &elem_vec, int &elem_id, int property_id, int cap_property_id,
+                                        vector < long long int > &shell_elem_id_vec, vector < long long int > &beam_elem_id_vec )
+{
+    long long int noffset = m_StructSettings.m_NodeOffset;
+    long long int eoffset = m_StructSettings.m_ElementOffset;
+
+    shell_elem_id_vec.clear();
+    beam_elem_id_vec.clear();
+
+    // Element numbering and property use are serial, formatting is not
+    int first_id = elem_id;
+    for ( size_t j = 0; j < elem_vec.size(); j++ )
+    {
+        if ( elem_vec[j]->GetElementType() != FeaElement::FEA_BEAM )
+        {
+            shell_elem_id_vec.push_back( elem_id );
+            if ( property_id >= 0 )
+            {
+                FeaMeshMgr.MarkPropMatUsed( property_id );
+            }
+        }
+        else
+        {
+            beam_elem_id_vec.push_back( elem_id );
+            if ( cap_property_id >= 0 )
+            {
+                FeaMeshMgr.MarkPropMatUsed( cap_property_id );
+            }
+        }
+
+        elem_id++;
+    }
+
+    WriteRecords( bdf_fp, elem_vec.size(), [&]( FormatBuffer & buf, size_t j )
+    {
+        if ( elem_vec[j]->GetElementType() != FeaElement::FEA_BEAM )
+        {
+            elem_vec[j]->WriteNASTRAN( buf, first_id + (int)j, property_id, noffset, eoffset );
+        }
+        else
+        {
+            elem_vec[j]->WriteNASTRAN( buf, first_id + (int)j, cap_property_id, noffset, eoffset );
+        }
+    } );
+}
+
 void CloseNASTRAN( FILE *dat_fp, FILE *bdf_header_fp, FILE *bdf_fp, FILE *nkey_fp )
 {
     if ( dat_fp )
@@ -1405,27 +1408,28 @@ void CloseNASTRAN( FILE *dat_fp, FILE *bdf_header_fp, FILE *bdf_fp, FILE *nkey_f
     }
 }
 
-void FeaMesh::WriteNASTRANSet( FILE* dat_fp, FILE* nkey_fp, int & set_num, vector < long long int > set_ids, const string &set_name, const long long int &offset )
+void FeaMesh::WriteNASTRANSet( FILE* dat_fp, FILE* nkey_fp, int & set_num, const vector < long long int > &set_ids, const string &set_name, const long long int &offset )
 {
     if ( set_ids.size() > 0 && dat_fp )
     {
         fprintf( dat_fp, "\n$ %d, %s\n", set_num, set_name.c_str() );
         fprintf( dat_fp, "SET %d = ", set_num );
 
-        for ( size_t i = 0; i < set_ids.size(); i++ )
+        size_t nid = set_ids.size();
+        WriteRecords( dat_fp, nid, [&]( FormatBuffer & buf, size_t i )
         {
-            fprintf( dat_fp, "%lld", set_ids[i] + offset );
+            buf.AppendInt( set_ids[i] + offset );
 
-            if ( i != set_ids.size() - 1 )
+            if ( i != nid - 1 )
             {
-                fprintf( dat_fp, "," );
+                buf.Append( ',' );
 
                 if ( ( i + 1 ) % 9 == 0 ) // 9 IDs per line
                 {
-                    fprintf( dat_fp, "\n" );
+                    buf.Append( '\n' );
                 }
             }
-        }
+        } );
 
         fprintf( dat_fp, "\n" );
 
@@ -1492,8 +1496,7 @@ void FeaMesh::WriteCalculixNodes( FILE* fp )
 
     if ( fp )
     {
-        int elem_id = 0;
-        char str[256];
+        vector < FeaNode* > node_vec;
 
         //==== Write Fixed Points ====//
         for ( size_t i = 0; i < m_NumFeaFixPoints; i++ )
@@ -1532,25 +1535,23 @@ void FeaMesh::WriteCalculixNodes( FILE* fp )
         {
             if ( m_FeaPartTypeVec[i] != vsp::FEA_FIX_POINT )
             {
-                bool NodeHeader = false;
+                node_vec.clear();
 
                 for ( unsigned int j = 0; j < (int)m_FeaNodeVec.size(); j++ )
                 {
-                    if ( m_FeaNodeVecUsed[ j ] )
+                    if ( m_FeaNodeVecUsed[ j ] && m_FeaNodeVec[ j ]->HasOnlyTag( i ) )
                     {
-                        if ( m_FeaNodeVec[ j ]->HasOnlyTag( i ) )
-                        {
-                            if ( !NodeHeader )
-                            {
-                                fprintf( fp, "** %s %s\n", m_FeaPartNameVec[i].c_str(), m_StructName.c_str() );
-                                fprintf( fp, "*NODE, NSET=N%s_%s\n", m_FeaPartNameVec[i].c_str(), m_StructName.c_str() );
-                                NodeHeader = true;
-                            }
-                            m_FeaNodeVec[j]->WriteCalculix( fp, noffset );
-                        }
+                        node_vec.push_back( m_FeaNodeVec[ j ] );
                     }
                 }
 
+                if ( !node_vec.empty() )
+                {
+                    fprintf( fp, "** %s %s\n", m_FeaPartNameVec[i].c_str(), m_StructName.c_str() );
+                    fprintf( fp, "*NODE, NSET=N%s_%s\n", m_FeaPartNameVec[i].c_str(), m_StructName.c_str() );
+                }
+                WriteCalculixNodeBlock( fp, node_vec );
+
                 fprintf( fp, "\n" );
             }
         }
@@ -1558,79 +1559,76 @@ void FeaMesh::WriteCalculixNodes( FILE* fp )
         //==== Write SubSurfaces ====//
         for ( unsigned int i = 0; i < m_NumFeaSubSurfs; i++ )
         {
-            bool SubSurfHeader = false;
+            node_vec.clear();
 
             for ( unsigned int j = 0; j < (int)m_FeaNodeVec.size(); j++ )
             {
-                if ( m_FeaNodeVecUsed[ j ] )
+                if ( m_FeaNodeVecUsed[ j ] && m_FeaNodeVec[ j ]->HasOnlyTag( i + m_NumFeaParts ) )
                 {
-                    if ( m_FeaNodeVec[ j ]->HasOnlyTag( i + m_NumFeaParts ) )
-                    {
-                        if ( !SubSurfHeader )
-                        {
-                            fprintf( fp, "** %s %s\n", m_SimpleSubSurfaceVec[i].GetName().c_str(), m_StructName.c_str() );
-                            fprintf( fp, "*NODE, NSET=N%s_%s\n", m_SimpleSubSurfaceVec[i].GetName().c_str(), m_StructName.c_str() );
-                            SubSurfHeader = true;
-                        }
-                        m_FeaNodeVec[j]->WriteCalculix( fp, noffset );
-                    }
+                    node_vec.push_back( m_FeaNodeVec[ j ] );
                 }
             }
+
+            if ( !node_vec.empty() )
+            {
+                fprintf( fp, "** %s %s\n", m_SimpleSubSurfaceVec[i].GetName().c_str(), m_StructName.c_str() );
+                fprintf( fp, "*NODE, NSET=N%s_%s\n", m_SimpleSubSurfaceVec[i].GetName().c_str(), m_StructName.c_str() );
+            }
+            WriteCalculixNodeBlock( fp, node_vec );
+
             fprintf( fp, "\n" );
         }
 
         //==== Intersection Nodes ====//
-        bool IntersectHeader = false;
+        node_vec.clear();
         for ( unsigned int j = 0; j < (int)m_FeaNodeVec.size(); j++ )
         {
-            if ( m_FeaNodeVecUsed[ j ] )
+            if ( m_FeaNodeVecUsed[ j ] && m_FeaNodeVec[j]->m_Tags.size() > 1 && !m_FeaNodeVec[j]->m_FixedPointFlag )
             {
-                if ( m_FeaNodeVec[j]->m_Tags.size() > 1 &&
-                     !m_FeaNodeVec[j]->m_FixedPointFlag )
-                {
-                    if ( !IntersectHeader )
-                    {
-                        fprintf( fp, "** Intersections %s\n", m_StructName.c_str() );
-                        fprintf( fp, "*NODE, NSET=Nintersections_%s\n", m_StructName.c_str() );
-                        IntersectHeader = true;
-                    }
-                    m_FeaNodeVec[j]->WriteCalculix( fp, noffset );
-                }
+                node_vec.push_back( m_FeaNodeVec[ j ] );
             }
         }
-        if ( IntersectHeader )
+
+        if ( !node_vec.empty() )
         {
+            fprintf( fp, "** Intersections %s\n", m_StructName.c_str() );
+            fprintf( fp, "*NODE, NSET=Nintersections_%s\n", m_StructName.c_str() );
+            WriteCalculixNodeBlock( fp, node_vec );
             fprintf( fp, "\n" );
         }
 
         //==== Remaining Nodes ====//
-        bool RemainingHeader = false;
+        node_vec.clear();
         for ( int i = 0; i < (int)m_FeaNodeVec.size(); i++ )
         {
-            if ( m_FeaNodeVecUsed[ i ] &&
-                 m_FeaNodeVec[i]->m_Tags.size() == 0 )
+            if ( m_FeaNodeVecUsed[ i ] && m_FeaNodeVec[i]->m_Tags.size() == 0 )
             {
-                if ( !RemainingHeader )
-                {
-                    fprintf( fp, "** Remaining Nodes %s\n", m_StructName.c_str() );
-                    fprintf( fp, "*NODE, NSET=RemainingNodes_%s\n", m_StructName.c_str() );
-                    RemainingHeader = true;
-                }
-                m_FeaNodeVec[i]->WriteCalculix( fp, noffset );
+                node_vec.push_back( m_FeaNodeVec[ i ] );
             }
         }
-        if ( RemainingHeader )
+
+        if ( !node_vec.empty() )
         {
+            fprintf( fp, "** Remaining Nodes %s\n", m_StructName.c_str() );
+            fprintf( fp, "*NODE, NSET=RemainingNodes_%s\n", m_StructName.c_str() );
+            WriteCalculixNodeBlock( fp, node_vec );
             fprintf( fp, "\n" );
         }
     }
 }
 
-void FeaMesh::WriteCalculixElements( FILE* fp )
+void FeaMesh::WriteCalculixNodeBlock( FILE* fp, const vector < FeaNode* > &node_vec )
 {
-    unsigned long long int noffset = m_StructSettings.m_NodeOffset;
-    unsigned long long int eoffset = m_StructSettings.m_ElementOffset;
+    long long int noffset = m_StructSettings.m_NodeOffset;
+
+    WriteRecords( fp, node_vec.size(), [&]( FormatBuffer & buf, size_t i )
+    {
+        node_vec[i]->WriteCalculix( buf, noffset );
+    } );
+}
 
+void FeaMesh::WriteCalculixElements( FILE* fp )
+{
     // This code does not currently support mixed quads and tris.
     // Element sets must be made unique.  Properties and orientation should only be written for
     // element sets that are actually used.
@@ -1638,7 +1636,7 @@ void FeaMesh::WriteCalculixElements( FILE* fp )
     if ( fp )
     {
         int elem_id = 1;
-        char str[256];
+        vector < FeaElement* > elem_vec;
 
         //==== Write Fixed Points ====//
         for ( size_t i = 0; i < m_NumFeaFixPoints; i++ )
@@ -1651,16 +1649,17 @@ void FeaMesh::WriteCalculixElements( FILE* fp )
                 fprintf( fp, "** Fixed Point: %s %s\n", m_FeaPartNameVec[fxpt.m_FeaPartIndex].c_str(), m_StructName.c_str() );
                 fprintf( fp, "*ELEMENT, TYPE=MASS, ELSET=EP%s_%s\n", m_FeaPartNameVec[fxpt.m_FeaPartIndex].c_str(), m_StructName.c_str() );
 
+                elem_vec.clear();
                 for ( int j = 0; j < m_FeaElementVec.size(); j++ )
                 {
                     if ( m_FeaElementVec[j]->GetFeaPartIndex() == fxpt.m_FeaPartIndex &&
                          m_FeaElementVec[j]->GetElementType() == FeaElement::FEA_POINT_MASS &&
                          m_FeaElementVec[j]->GetFeaSSIndex() < 0 )
                     {
-                        elem_id++;
-                        m_FeaElementVec[j]->WriteCalculix( fp, elem_id, noffset, eoffset );
+                        elem_vec.push_back( m_FeaElementVec[j] );
                     }
                 }
+                WriteCalculixElementBlock( fp, elem_vec, elem_id );
 
                 fprintf( fp, "\n" );
 
@@ -1688,6 +1687,7 @@ void FeaMesh::WriteCalculixElements( FILE* fp )
 
                         fprintf( fp, "*ELEMENT, TYPE=S%d, ELSET=E%s_%s_%d\n", nnode, m_FeaPartNameVec[i].c_str(), m_StructName.c_str(), isurf );
 
+                        elem_vec.clear();
                         for ( int j = 0; j < m_FeaElementVec.size(); j++ )
                         {
                             if ( m_FeaElementVec[j]->GetFeaPartIndex() == i &&
@@ -1695,10 +1695,10 @@ void FeaMesh::WriteCalculixElements( FILE* fp )
                                  m_FeaElementVec[j]->GetFeaSSIndex() < 0 &&
                                  m_FeaElementVec[j]->GetFeaPartSurfNum() == isurf )
                             {
-                                elem_id++;
-                                m_FeaElementVec[j]->WriteCalculix( fp, elem_id, noffset, eoffset );
+                                elem_vec.push_back( m_FeaElementVec[j] );
                             }
                         }
+                        WriteCalculixElementBlock( fp, elem_vec, elem_id );
                         fprintf( fp, "\n" );
                     }
 
@@ -1709,6 +1709,7 @@ void FeaMesh::WriteCalculixElements( FILE* fp )
 
                         fprintf( fp, "*ELEMENT, TYPE=S%d, ELSET=E%s_%s_%d\n", nnode, m_FeaPartNameVec[i].c_str(), m_StructName.c_str(), isurf );
 
+                        elem_vec.clear();
                         for ( int j = 0; j < m_FeaElementVec.size(); j++ )
                         {
                             if ( m_FeaElementVec[j]->GetFeaPartIndex() == i &&
@@ -1716,10 +1717,10 @@ void FeaMesh::WriteCalculixElements( FILE* fp )
                                  m_FeaElementVec[j]->GetFeaSSIndex() < 0 &&
                                  m_FeaElementVec[j]->GetFeaPartSurfNum() == isurf )
                             {
-                                elem_id++;
-                                m_FeaElementVec[j]->WriteCalculix( fp, elem_id, noffset, eoffset );
+                                elem_vec.push_back( m_FeaElementVec[j] );
                             }
                         }
+                        WriteCalculixElementBlock( fp, elem_vec, elem_id );
                         fprintf( fp, "\n" );
                     }
 
@@ -1727,6 +1728,7 @@ void FeaMesh::WriteCalculixElements( FILE* fp )
                     {
                         fprintf( fp, "*ELEMENT, TYPE=B32R, ELSET=EB%s_%s_%d_CAP\n", m_FeaPartNameVec[i].c_str(), m_StructName.c_str(), isurf );
 
+                        elem_vec.clear();
                         for ( int j = 0; j < m_FeaElementVec.size(); j++ )
                         {
                             if ( m_FeaElementVec[j]->GetFeaPartIndex() == i &&
@@ -1734,10 +1736,10 @@ void FeaMesh::WriteCalculixElements( FILE* fp )
                                  m_FeaElementVec[j]->GetFeaSSIndex() < 0 &&
                                  m_FeaElementVec[j]->GetFeaPartSurfNum() == isurf )
                             {
-                                elem_id++;
-                                m_FeaElementVec[j]->WriteCalculix( fp, elem_id, noffset, eoffset );
+                                elem_vec.push_back( m_FeaElementVec[j] );
                             }
                         }
+                        WriteCalculixElementBlock( fp, elem_vec, elem_id );
 
                         if ( m_StructSettings.m_BeamPerElementNormal )
                         {
@@ -1745,18 +1747,7 @@ void FeaMesh::WriteCalculixElements( FILE* fp )
                             fprintf( fp, "\n" );
                             fprintf( fp, "*NORMAL\n" );
 
-                            for ( int j = 0; j < m_FeaElementVec.size(); j++ )
-                            {
-                                if ( m_FeaElementVec[j]->GetFeaPartIndex() == i &&
-                                     m_FeaElementVec[j]->GetElementType() == FeaElement::FEA_BEAM &&
-                                     m_FeaElementVec[j]->GetFeaSSIndex() < 0 &&
-                                     m_FeaElementVec[j]->GetFeaPartSurfNum() == isurf )
-                                {
-                                    FeaBeam* beam = dynamic_cast<FeaBeam*>( m_FeaElementVec[j] );
-                                    assert( beam );
-                                    beam->WriteCalculixNormal( fp, noffset, eoffset );
-                                }
-                            }
+                            WriteCalculixNormalBlock( fp, elem_vec );
                         }
 
                         fprintf( fp, "\n" );
@@ -1779,16 +1770,17 @@ void FeaMesh::WriteCalculixElements( FILE* fp )
 
                     fprintf( fp, "\n*ELEMENT, TYPE=S%d, ELSET=E%s_%s_%d\n", nnode, m_SimpleSubSurfaceVec[i].GetName().c_str(), m_StructName.c_str(), isurf );
 
+                    elem_vec.clear();
                     for ( int j = 0; j < m_FeaElementVec.size(); j++ )
                     {
                         if ( m_FeaElementVec[j]->GetFeaSSIndex() == i &&
                              ( m_FeaElementVec[j]->GetElementType() == FeaElement::FEA_TRI_3 || m_FeaElementVec[j]->GetElementType() == FeaElement::FEA_TRI_6 ) &&
                              m_FeaElementVec[j]->GetFeaPartSurfNum() == isurf )
                         {
-                            elem_id++;
-                            m_FeaElementVec[j]->WriteCalculix( fp, elem_id, noffset, eoffset );
+                            elem_vec.push_back( m_FeaElementVec[j] );
                         }
                     }
+                    WriteCalculixElementBlock( fp, elem_vec, elem_id );
                     fprintf( fp, "\n" );
                 }
 
@@ -1799,16 +1791,17 @@ void FeaMesh::WriteCalculixElements( FILE* fp )
 
                     fprintf( fp, "\n*ELEMENT, TYPE=S%d, ELSET=E%s_%s_%d\n", nnode, m_SimpleSubSurfaceVec[i].GetName().c_str(), m_StructName.c_str(), isurf );
 
+                    elem_vec.clear();
                     for ( int j = 0; j < m_FeaElementVec.size(); j++ )
                     {
                         if ( m_FeaElementVec[j]->GetFeaSSIndex() == i &&
                              ( m_FeaElementVec[j]->GetElementType() == FeaElement::FEA_QUAD_4 || m_FeaElementVec[j]->GetElementType() == FeaElement::FEA_QUAD_8 ) &&
                              m_FeaElementVec[j]->GetFeaPartSurfNum() == isurf )
                         {
-                            elem_id++;
-                            m_FeaElementVec[j]->WriteCalculix( fp, elem_id, noffset, eoffset );
+                            elem_vec.push_back( m_FeaElementVec[j] );
                         }
                     }
+                    WriteCalculixElementBlock( fp, elem_vec, elem_id );
                     fprintf( fp, "\n" );
                 }
 
@@ -1817,16 +1810,17 @@ void FeaMesh::WriteCalculixElements( FILE* fp )
                     fprintf( fp, "\n" );
                     fprintf( fp, "*ELEMENT, TYPE=B32R, ELSET=EB%s_%s_%d_CAP\n", m_SimpleSubSurfaceVec[i].GetName().c_str(), m_StructName.c_str(), isurf );
 
+                    elem_vec.clear();
                     for ( int j = 0; j < m_FeaElementVec.size(); j++ )
                     {
                         if ( m_FeaElementVec[j]->GetFeaSSIndex() == i &&
                              m_FeaElementVec[j]->GetElementType() == FeaElement::FEA_BEAM &&
                              m_FeaElementVec[j]->GetFeaPartSurfNum() == isurf )
                         {
-                            elem_id++;
-                            m_FeaElementVec[j]->WriteCalculix( fp, elem_id, noffset, eoffset );
+                            elem_vec.push_back( m_FeaElementVec[j] );
                         }
                     }
+                    WriteCalculixElementBlock( fp, elem_vec, elem_id );
 
 
                     if ( m_StructSettings.m_BeamPerElementNormal )
@@ -1835,17 +1829,7 @@ void FeaMesh::WriteCalculixElements( FILE* fp )
                         fprintf( fp, "\n" );
                         fprintf( fp, "*NORMAL\n" );
 
-                        for ( int j = 0; j < m_FeaElementVec.size(); j++ )
-                        {
-                            if ( m_FeaElementVec[j]->GetFeaSSIndex() == i &&
-                                 m_FeaElementVec[j]->GetElementType() == FeaElement::FEA_BEAM &&
-                                 m_FeaElementVec[j]->GetFeaPartSurfNum() == isurf )
-                            {
-                                FeaBeam* beam = dynamic_cast<FeaBeam*>( m_FeaElementVec[j] );
-                                assert( beam );
-                                beam->WriteCalculixNormal( fp, noffset, eoffset );
-                            }
-                        }
+                        WriteCalculixNormalBlock( fp, elem_vec );
                     }
 
                     fprintf( fp, "\n" );
@@ -1855,6 +1839,34 @@ void FeaMesh::WriteCalculixElements( FILE* fp )
     }
 }
 
+void FeaMesh::WriteCalculixElementBlock( FILE* fp, const vector < FeaElement* > &elem_vec, int &elem_id )
+{
+    long long int noffset = m_StructSettings.m_NodeOffset;
+    long long int eoffset = m_StructSettings.m_ElementOffset;
+
+    // Element IDs are pre-incremented
+    int first_id = elem_id + 1;
+    elem_id += (int)elem_vec.size();
+
+    WriteRecords( fp, elem_vec.size(), [&]( FormatBuffer & buf, size_t j )
+    {
+        elem_vec[j]->WriteCalculix( buf, first_id + (int)j, noffset, eoffset );
+    } );
+}
+
+void FeaMesh::WriteCalculixNormalBlock( FILE* fp, const vector < FeaElement* > &beam_vec )
+{
+    long long int noffset = m_StructSettings.m_NodeOffset;
+    long long int eoffset = m_StructSettings.m_ElementOffset;
+
+    WriteRecords( fp, beam_vec.size(), [&]( FormatBuffer & buf, size_t j )
+    {
+        FeaBeam* beam = dynamic_cast<FeaBeam*>( beam_vec[j] );
+        assert( beam );
+        beam->WriteCalculixNormal( buf, noffset, eoffset );
+    } );
+}
+
 void FeaMesh::WriteCalculixBCs( FILE* fp )
 {
     unsigned long long int noffset = m_StructSettings.m_NodeOffset;
@@ -9,6 +9,7 @@
 #include "SimpleMeshSettings.h"
 #include "SimpleSubSurface.h"
 #include "SimpleBC.h"
+#include "Mesh.h"
 
 void CloseNASTRAN( FILE *dat_fp, FILE *bdf_header_fp, FILE *bdf_fp, FILE *nkey_fp );
 
@@ -85,6 +86,9 @@ public:
     virtual void WriteCalculixHeader( FILE* fp );
     virtual void WriteCalculixNodes( FILE* fp );
     virtual void WriteCalculixElements( FILE* fp );
+    virtual void WriteCalculixNodeBlock( FILE* fp, const vector < FeaNode* > &node_vec );
+    virtual void WriteCalculixElementBlock( FILE* fp, const vector < FeaElement* > &elem_vec, int &elem_id );
+    virtual void WriteCalculixNormalBlock( FILE* fp, const vector < FeaElement* > &beam_vec );
     virtual void WriteCalculixBCs( FILE* fp );
     virtual void WriteCalculixProperties( FILE* fp );
 
@@ -94,12 +98,15 @@ public:
     virtual void WriteNASTRANNodes( FILE* dat_fp, FILE* bdf_fp, FILE* nkey_fp, int &set_cnt );
     virtual void WriteNASTRANSPC1( FILE *bdf_fp );
     virtual void WriteNASTRANElements( FILE* dat_fp, FILE* bdf_fp, FILE* nkey_fp, int &set_cnt );
+    virtual void WriteNASTRANNodeBlock( FILE* bdf_fp, const vector < FeaNode* > &node_vec, vector < long long int > &node_id_vec );
+    virtual void WriteNASTRANElementBlock( FILE* bdf_fp, const vector < FeaElement* > &elem_vec, int &elem_id, int property_id, int cap_property_id,
+                                           vector < long long int > &shell_elem_id_vec, vector < long long int > &beam_elem_id_vec );
 
     virtual void WriteGmsh();
     virtual void WriteSTL();
 
     // Was protected.
-    virtual void WriteNASTRANSet( FILE* dat_fp, FILE* nkey_fp, int & set_num, vector < long long int > set_ids, const string &set_name, const long long int &offset );
+    virtual void WriteNASTRANSet( FILE* dat_fp, FILE* nkey_fp, int & set_num, const vector < long long int > &set_ids, const string &set_name, const long long int &offset );
 
     virtual void ComputeWriteMass();
 
@@ -169,6 +176,9 @@ public:
     // m_PartSurfOrientation[i][j] == GetFeaSurf(i,j)->GetFeaElementOrientation()
     vector < vector < vec3d > > m_PartSurfOrientation;
 
+    // Surface meshes from the last run, kept across Cleanup for incremental remeshing.
+    RemeshCache m_RemeshCache;
+
 
 // Was private.
     bool m_MeshDOUpToDate;
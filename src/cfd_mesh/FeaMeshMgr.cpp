@@ -44,6 +44,8 @@ FeaMeshMgrSingleton::FeaMeshMgrSingleton() : CfdMeshMgrSingleton()
 
     m_FeaStructID = string();
     m_ActiveMesh = NULL;
+
+    m_ConcurrentMeshFlag = false;
 }
 
 FeaMeshMgrSingleton::~FeaMeshMgrSingleton()
@@ -360,7 +362,7 @@ void FeaMeshMgrSingleton::TransferBCData()
 
         for ( int i = 0; i < nbc; i++ )
         {
-            GetMeshPtr()->m_BCVec[i].CopyFrom( bc_vec[i] );
+            GetMeshPtr()->m_BCVec[i].CopyFrom( bc_vec[i], this );
         }
     }
 }
@@ -440,6 +442,20 @@ void FeaMeshMgrSingleton::GenerateFeaMesh()
     addOutputText( "Init Timer\n" );
 #endif
 
+    if ( PrepareFeaMesh() )
+    {
+        ComputeFeaMesh();
+        FinishFeaMesh();
+    }
+
+    m_FeaMeshInProgress = false;
+    MessageMgr::getInstance().Send( "ScreenMgr", "UpdateAllScreens" );
+}
+
+// Everything that reads the Vehicle, StructureMgr or other shared model data.
+// Must be run serially.
+bool FeaMeshMgrSingleton::PrepareFeaMesh()
+{
     addOutputText( "Transfer Mesh Settings\n" );
     TransferMeshSettings();
 
@@ -449,9 +465,7 @@ void FeaMeshMgrSingleton::GenerateFeaMesh()
     if ( m_SurfVec.size() == 0 )
     {
         addOutputText( "No Surfaces.  Done.\n" );
-        m_FeaMeshInProgress = false;
-        MessageMgr::getInstance().Send( "ScreenMgr", "UpdateAllScreens" );
-        return;
+        return false;
     }
 
     if ( !m_CADOnlyFlag )
@@ -477,9 +491,7 @@ void FeaMeshMgrSingleton::GenerateFeaMesh()
     if ( !CheckPropMat() )
     {
         addOutputText( "Material or property not identified.\n" );
-        m_FeaMeshInProgress = false;
-        MessageMgr::getInstance().Send( "ScreenMgr", "UpdateAllScreens" );
-        return;
+        return false;
     }
 
     // Needs to be after TransferSubSurfData so SubSurf BC's can be indexed.
@@ -511,9 +523,17 @@ void FeaMeshMgrSingleton::GenerateFeaMesh()
 
     // TODO: Update and Build Domain for Half Mesh?
 
+    // Appends any WakeMgr wake surfaces, so it stays with the serial setup.
     addOutputText( "Build Slice Planes\n" );
     BuildGrid();
 
+    return true;
+}
+
+// Intersection and meshing.  Only touches this manager's surfaces and its
+// active FeaMesh, so separate managers may run this concurrently.
+void FeaMeshMgrSingleton::ComputeFeaMesh()
+{
     // addOutputText( "Intersect\n" ); // Output in intersect() itself.
     Intersect();
 
@@ -533,13 +553,6 @@ void FeaMeshMgrSingleton::GenerateFeaMesh()
 
     if ( m_CADOnlyFlag )
     {
-        UpdateDrawObjs();
-
-        addOutputText( "Finished\n" );
-
-        m_FeaMeshInProgress = false;
-        m_CADOnlyFlag = false;
-        MessageMgr::getInstance().Send( "ScreenMgr", "UpdateAllScreens" );
         return;
     }
 
@@ -571,9 +584,6 @@ void FeaMeshMgrSingleton::GenerateFeaMesh()
     addOutputText( "Post Mesh\n" );
     PostMesh();
 
-    addOutputText( "Build Single Tag Map\n" );
-    SubSurfaceMgr.BuildSingleTagMap();
-
     addOutputText( "Check Subsurf Border Intersect\n" );
     CheckSubSurfBorderIntersect();
 
@@ -590,13 +600,22 @@ void FeaMeshMgrSingleton::GenerateFeaMesh()
     TagFeaNodes();
 
     GetMeshPtr()->m_MeshReady = true;
+}
+
+void FeaMeshMgrSingleton::FinishFeaMesh()
+{
+    if ( !m_CADOnlyFlag )
+    {
+        // The tag maps are shared, so they are only written from the serial phase
+        addOutputText( "Build Single Tag Map\n" );
+        UpdateSubSurfTagMaps();
+    }
 
     UpdateDrawObjs();
 
     addOutputText( "Finished\n" );
 
-    m_FeaMeshInProgress = false;
-    MessageMgr::getInstance().Send( "ScreenMgr", "UpdateAllScreens" );
+    m_CADOnlyFlag = false;
 }
 
 void FeaMeshMgrSingleton::ExportFeaMesh( string structID )
@@ -1573,6 +1592,23 @@ void FeaMeshMgrSingleton::BuildFeaMesh()
     }
 }
 
+// Only structures with incremental remeshing turned on keep their surface meshes between runs.
+RemeshCache* FeaMeshMgrSingleton::GetRemeshCache()
+{
+    if ( !GetMeshPtr() )
+    {
+        return NULL;
+    }
+
+    if ( !GetMeshPtr()->m_StructSettings.m_IncrementalRemeshFlag )
+    {
+        GetMeshPtr()->m_RemeshCache.Clear();
+        return NULL;
+    }
+
+    return &GetMeshPtr()->m_RemeshCache;
+}
+
 void FeaMeshMgrSingleton::SetFixPointSurfaceNodes()
 {
     for ( size_t n = 0; n < GetMeshPtr()->m_NumFeaFixPoints; n++ )
@@ -2640,7 +2676,7 @@ void FeaMeshMgrSingleton::TagFeaNodes()
         {
             if ( GetMeshPtr()->m_FeaNodeVecUsed[ j ] )
             {
-                GetMeshPtr()->m_BCVec[i].ApplyTo( GetMeshPtr()->m_FeaNodeVec[j] );
+                GetMeshPtr()->m_BCVec[i].ApplyTo( GetMeshPtr()->m_FeaNodeVec[j], GetMeshPtr()->m_NumFeaParts );
             }
         }
     }
@@ -2795,6 +2831,12 @@ Surf* FeaMeshMgrSingleton::GetFeaSurf( int FeaPartID, int surf_num )
 
 void FeaMeshMgrSingleton::MeshUnMeshed( const vector < string > & idvec )
 {
+    if ( m_ConcurrentMeshFlag )
+    {
+        MeshUnMeshedConcurrent( idvec );
+        return;
+    }
+
     for ( int i = 0; i < idvec.size(); i++ )
     {
         SetFeaMeshStructID( idvec[i] );
@@ -2812,6 +2854,90 @@ void FeaMeshMgrSingleton::MeshUnMeshed( const vector < string > & idvec )
     }
 }
 
+// Each structure is meshed by its own manager instance, writing into the
+// FeaMesh held in m_MeshPtrMap.  Setup reads shared model data and is done
+// serially; intersection and meshing of the structures run concurrently.
+void FeaMeshMgrSingleton::MeshUnMeshedConcurrent( const vector < string > & idvec )
+{
+    m_FeaMeshInProgress = true;
+
+    // Intersection data held here would belong to a structure that may be re-meshed.
+    CleanUp();
+    m_IntersectStructID = string();
+
+    vector < FeaMeshMgrSingleton* > context_vec;
+
+    for ( int i = 0; i < idvec.size(); i++ )
+    {
+        SetActiveMesh( idvec[i] );
+
+        if ( m_ActiveMesh && !m_ActiveMesh->m_MeshReady )
+        {
+            FeaMeshMgrSingleton* context = new FeaMeshMgrSingleton();
+            context->SetMeshContext( idvec[i], m_ActiveMesh );
+            context_vec.push_back( context );
+        }
+    }
+
+    int ncontext = context_vec.size();
+    vector < int > prepared( ncontext, 0 );
+
+    for ( int i = 0; i < ncontext; i++ )
+    {
+        FeaStructure* fea_struct = StructureMgr.GetFeaStruct( context_vec[i]->GetFeaMeshStructID() );
+        if ( fea_struct )
+        {
+            context_vec[i]->addOutputText( "Structure " + fea_struct->GetName() + "\n" );
+        }
+
+        prepared[i] = context_vec[i]->PrepareFeaMesh();
+    }
+
+    #pragma omp parallel for schedule( dynamic )
+    for ( int i = 0; i < ncontext; i++ )
+    {
+        if ( prepared[i] )
+        {
+            context_vec[i]->ComputeFeaMesh();
+        }
+
+        // Each structure's output is sent as one block when it completes.
+        #pragma omp critical( FeaMeshMgr_ConcurrentOutput )
+        context_vec[i]->FlushOutputText();
+    }
+
+    for ( int i = 0; i < ncontext; i++ )
+    {
+        if ( prepared[i] )
+        {
+            context_vec[i]->FinishFeaMesh();
+        }
+        context_vec[i]->FlushOutputText();
+
+        delete context_vec[i];
+    }
+
+    if ( !idvec.empty() )
+    {
+        m_FeaStructID = idvec.back();
+        SetActiveMesh( m_FeaStructID );
+    }
+
+    m_FeaMeshInProgress = false;
+    MessageMgr::getInstance().Send( "ScreenMgr", "UpdateAllScreens" );
+}
+
+void FeaMeshMgrSingleton::SetMeshContext( const string &struct_id, FeaMesh* mesh )
+{
+    m_FeaStructID = struct_id;
+    m_IntersectStructID = struct_id;
+
+    // Not added to m_MeshPtrMap, the mesh is owned by the calling manager.
+    m_ActiveMesh = mesh;
+
+    m_BufferOutputFlag = true;
+}
+
 void FeaMeshMgrSingleton::CleanupMeshes( const vector < string > & idvec )
 {
     for ( int i = 0; i < idvec.size(); i++ )
@@ -96,6 +96,9 @@ public:
     virtual bool LoadSurfaces();
     virtual void LoadSkins();
     virtual void GenerateFeaMesh();
+    virtual bool PrepareFeaMesh();
+    virtual void ComputeFeaMesh();
+    virtual void FinishFeaMesh();
     virtual void ExportFeaMesh( string structID );
     virtual void ExportCADFiles();
     virtual void TransferMeshSettings();
@@ -123,6 +126,8 @@ public:
     virtual void RemoveSubSurfFeaTris();
     virtual void TagFeaNodes();
 
+    virtual RemeshCache* GetRemeshCache();
+
     virtual void SetFeaMeshStructID( string struct_id )
     {
         if ( m_FeaStructID == struct_id )  // Already set, do nothing.
@@ -169,6 +174,15 @@ public:
         m_CADOnlyFlag = cad_only_flag;
     }
 
+    virtual void SetConcurrentMeshFlag( bool concurrent_flag )
+    {
+        m_ConcurrentMeshFlag = concurrent_flag;
+    }
+    virtual bool GetConcurrentMeshFlag()
+    {
+        return m_ConcurrentMeshFlag;
+    }
+
     virtual void TransferDrawObjData();
 
     virtual void UpdateDrawObjs();
@@ -210,6 +224,8 @@ public:
     virtual Surf* GetFeaSurf( int FeaPartID, int surf_num );
 
     virtual void MeshUnMeshed( const vector < string > & idvec );
+    virtual void MeshUnMeshedConcurrent( const vector < string > & idvec );
+    virtual void SetMeshContext( const string &struct_id, FeaMesh* mesh );
     virtual void CleanupMeshes( const vector < string > & idvec );
     virtual void ExportAssemblyMesh( const string &assembly_id );
 
@@ -237,6 +253,7 @@ protected:
 
     bool m_FeaMeshInProgress;
     bool m_CADOnlyFlag; // Indicates that only meshing should be performed, but the surfaces are still exported
+    bool m_ConcurrentMeshFlag; // MeshUnMeshed() meshes each structure in its own manager, in parallel
 
     string m_FeaStructID;
 
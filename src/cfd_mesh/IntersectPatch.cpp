@@ -14,7 +14,7 @@
 
 #include "eli/geom/intersect/intersect_surface.hpp"
 
-void intersect( const SurfPatch& bp1, const SurfPatch& bp2, SurfaceIntersectionSingleton *MeshMgr )
+void intersect( const SurfPatch& bp1, const SurfPatch& bp2, vector< PatchISeg > & isegs )
 {
     int MAX_SUB = 12;
     int MIN_SUB = 3;
@@ -43,7 +43,7 @@ void intersect( const SurfPatch& bp1, const SurfPatch& bp2, SurfaceIntersectionS
     if ( ( planar1 || bp1.GetSubDepth() > MAX_SUB ) &&
          ( planar2 || bp2.GetSubDepth() > MAX_SUB ) )
     {
-        intersect_quads( bp1, bp2, MeshMgr );          // Plane - Plane Intersection
+        intersect_quads( bp1, bp2, isegs );          // Plane - Plane Intersection
     }
     else
     {
@@ -71,10 +71,10 @@ void intersect( const SurfPatch& bp1, const SurfPatch& bp2, SurfaceIntersectionS
 
             bp1.split_patch( bps0, bps1, bps2, bps3 );      // Split Patch1 and Keep Subdividing
 
-            intersect( bps0, bp2, MeshMgr );
-            intersect( bps1, bp2, MeshMgr );
-            intersect( bps2, bp2, MeshMgr );
-            intersect( bps3, bp2, MeshMgr );
+            intersect( bps0, bp2, isegs );
+            intersect( bps1, bp2, isegs );
+            intersect( bps2, bp2, isegs );
+            intersect( bps3, bp2, isegs );
         }
         else
         {
@@ -89,15 +89,15 @@ void intersect( const SurfPatch& bp1, const SurfPatch& bp2, SurfaceIntersectionS
 
             bp2.split_patch( bps0, bps1, bps2, bps3 );      // Split Patch2 and Keep Subdividing
 
-            intersect( bp1, bps0, MeshMgr );
-            intersect( bp1, bps1, MeshMgr );
-            intersect( bp1, bps2, MeshMgr );
-            intersect( bp1, bps3, MeshMgr );
+            intersect( bp1, bps0, isegs );
+            intersect( bp1, bps1, isegs );
+            intersect( bp1, bps2, isegs );
+            intersect( bp1, bps3, isegs );
         }
     }
 }
 
-void intersect_quads( const SurfPatch& pa, const SurfPatch& pb, SurfaceIntersectionSingleton *MeshMgr )
+void intersect_quads( const SurfPatch& pa, const SurfPatch& pb, vector< PatchISeg > & isegs )
 {
     int iflag;
     int coplanar = 0; // Must be initialized to 0 before use in tri_tri_intersection_test_3d
@@ -138,7 +138,11 @@ void intersect_quads( const SurfPatch& pa, const SurfPatch& pb, SurfaceIntersect
     iflag = tri_tri_intersection_test_3d( a0.v, a2.v, a3.v, b0.v, b2.v, b3.v, &coplanar, ip0.v, ip1.v );
     if ( iflag && !coplanar )
     {
-        MeshMgr->AddIntersectionSeg( pa, pb, ip0, ip1 );
+        PatchISeg iseg;
+        if ( project_intersect_seg( pa, pb, ip0, ip1, iseg ) )
+        {
+            isegs.push_back( iseg );
+        }
     }
 
     //==== Tri A1 and B2 ====//
@@ -146,7 +150,11 @@ void intersect_quads( const SurfPatch& pa, const SurfPatch& pb, SurfaceIntersect
     iflag = tri_tri_intersection_test_3d( a0.v, a2.v, a3.v, b0.v, b1.v, b2.v, &coplanar, ip0.v, ip1.v );
     if ( iflag && !coplanar )
     {
-        MeshMgr->AddIntersectionSeg( pa, pb, ip0, ip1 );
+        PatchISeg iseg;
+        if ( project_intersect_seg( pa, pb, ip0, ip1, iseg ) )
+        {
+            isegs.push_back( iseg );
+        }
     }
 
     //==== Tri A2 and B1 ====//
@@ -154,7 +162,11 @@ void intersect_quads( const SurfPatch& pa, const SurfPatch& pb, SurfaceIntersect
     iflag = tri_tri_intersection_test_3d( a0.v, a1.v, a2.v, b0.v, b2.v, b3.v, &coplanar, ip0.v, ip1.v );
     if ( iflag && !coplanar )
     {
-        MeshMgr->AddIntersectionSeg( pa, pb,  ip0, ip1 );
+        PatchISeg iseg;
+        if ( project_intersect_seg( pa, pb, ip0, ip1, iseg ) )
+        {
+            isegs.push_back( iseg );
+        }
     }
 
     //==== Tri A2 and B2 ====//
@@ -162,8 +174,98 @@ void intersect_quads( const SurfPatch& pa, const SurfPatch& pb, SurfaceIntersect
     iflag = tri_tri_intersection_test_3d( a0.v, a1.v, a2.v, b0.v, b1.v, b2.v, &coplanar, ip0.v, ip1.v );
     if ( iflag && !coplanar )
     {
-        MeshMgr->AddIntersectionSeg( pa, pb, ip0, ip1 );
+        PatchISeg iseg;
+        if ( project_intersect_seg( pa, pb, ip0, ip1, iseg ) )
+        {
+            isegs.push_back( iseg );
+        }
+    }
+}
+
+// Project an intersection segment onto both patches.  Returns false if the segment is degenerate
+// or lies on a shared patch boundary and should not be carried forward.
+bool project_intersect_seg( const SurfPatch& pA, const SurfPatch& pB, const vec3d & ip0, const vec3d & ip1, PatchISeg & iseg )
+{
+    double d = dist_squared( ip0, ip1 );
+    if ( d < DBL_EPSILON )
+    {
+        return false;
     }
+
+    vec2d plane_uwA0;
+    pA.find_closest_uw_planar_approx( ip0, plane_uwA0.v );
+
+    vec2d plane_uwB0;
+    pB.find_closest_uw_planar_approx( ip0, plane_uwB0.v );
+
+    vec2d plane_uwA1;
+    pA.find_closest_uw_planar_approx( ip1, plane_uwA1.v );
+
+    vec2d plane_uwB1;
+    pB.find_closest_uw_planar_approx( ip1, plane_uwB1.v );
+
+    // Intersections that lie exactly on a patch boundary will actually intersect both patches
+    // that share that boundary.  So, detect intersections that lie on the patch minimum edge
+    // and don't carry those forward.  Don't do this if the minimum parameter is zero.  I.e.
+    // there is no prior patch.
+
+    double tol = 1e-10; // Tolerance buildup due to SurfPatch::find_closest_uw_planar_approx and other inaccuracies
+
+    if ( pA.get_u_min() > 0.0 ) // if Patch A is not the very beginning of u
+    {
+        double lim = pA.get_u_min() + tol;
+        // if both points projected to A are on the starting edge of u
+        if ( plane_uwA0.v[0] <= lim && plane_uwA1.v[0] <= lim )
+        {
+            return false;
+        }
+    }
+
+    if ( pB.get_u_min() > 0.0 ) // if Patch B is not the very beginning of u
+    {
+        double lim = pB.get_u_min() + tol;
+        // if both points projected to B are on the starting edge of u
+        if ( plane_uwB0.v[0] <= lim && plane_uwB1.v[0] <= lim )
+        {
+            return false;
+        }
+    }
+
+    if ( pA.get_w_min() > 0.0 ) // if Patch A is not the very beginning of w
+    {
+        double lim = pA.get_w_min() + tol;
+        // if both points projected to A are on the starting edge of w
+        if ( plane_uwA0.v[1] <= lim && plane_uwA1.v[1] <= lim )
+        {
+            return false;
+        }
+    }
+
+    if ( pB.get_w_min() > 0.0 ) // if Patch B is not the very beginning of w
+    {
+        double lim = pB.get_w_min() + tol;
+        // if both points projected to B are on the starting edge of w
+        if ( plane_uwB0.v[1] <= lim && plane_uwB1.v[1] <= lim )
+        {
+            return false;
+        }
+    }
+
+    pA.find_closest_uw( ip0, plane_uwA0.v, iseg.m_UWA[0].v );
+    pB.find_closest_uw( ip0, plane_uwB0.v, iseg.m_UWB[0].v );
+    pA.find_closest_uw( ip1, plane_uwA1.v, iseg.m_UWA[1].v );
+    pB.find_closest_uw( ip1, plane_uwB1.v, iseg.m_UWB[1].v );
+
+    iseg.m_SurfA = pA.get_surf_ptr();
+    iseg.m_SurfB = pB.get_surf_ptr();
+    iseg.m_Pnt[0] = ip0;
+    iseg.m_Pnt[1] = ip1;
+
+    // Identify rectangles to represent final patches
+    iseg.m_PatchADrawLines = pA.GetPatchDrawLines();
+    iseg.m_PatchBDrawLines = pB.GetPatchDrawLines();
+
+    return true;
 }
 
 void refine_intersect_pt( const vec3d& pt, const SurfPatch &pA, double uwA[2], const SurfPatch &pB, double uwB[2] )
@@ -24,12 +24,31 @@
 #include <list>
 using namespace std;
 
+class Surf;
 class SurfaceIntersectionSingleton;
 class CfdMeshMgrSingleton;
 
+//===== Intersection Segment Between Two Patches =====//
+// Holds everything AddIntersectionSeg needs from the (possibly temporary) patches so that
+// patch intersection can run without touching the mesh manager.
+class PatchISeg
+{
+public:
+    Surf* m_SurfA;
+    Surf* m_SurfB;
+
+    vec3d m_Pnt[2];
+    vec2d m_UWA[2];
+    vec2d m_UWB[2];
+
+    vector < vec3d > m_PatchADrawLines;
+    vector < vec3d > m_PatchBDrawLines;
+};
+
 //===== Intersect Two Bezier Patches  =====//
-void intersect( const SurfPatch& bp1, const SurfPatch& bp2, SurfaceIntersectionSingleton *MeshMgr );
-void intersect_quads( const SurfPatch& pa, const SurfPatch& pb, SurfaceIntersectionSingleton *MeshMgr );
+void intersect( const SurfPatch& bp1, const SurfPatch& bp2, vector< PatchISeg > & isegs );
+void intersect_quads( const SurfPatch& pa, const SurfPatch& pb, vector< PatchISeg > & isegs );
+bool project_intersect_seg( const SurfPatch& pA, const SurfPatch& pB, const vec3d & ip0, const vec3d & ip1, PatchISeg & iseg );
 void refine_intersect_pt( const vec3d& pt, const SurfPatch &pA, double uwA[2], const SurfPatch &pB, double uwB[2] );
 double refine_intersect_pt( const vec3d& pt, Surf *sA, vec2d &uwA, Surf *sB, vec2d &uwB );
 
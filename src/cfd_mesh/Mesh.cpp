@@ -14,6 +14,7 @@
 #include <triangle.h>
 #include <triangle_api.h>
 #include "SurfaceIntersectionMgr.h"
+#include "StlHelper.h"
 
 bool LongEdgePairLengthCompare( const pair< Edge*, double >& a, const pair< Edge*, double >& b )
 {
@@ -28,6 +29,10 @@ bool ShortEdgeTargetLengthCompare( const Edge* a, const Edge* b )
     return ( a->target_len < b->target_len );
 }
 
+// FindNode match tolerance, also used as the node hash cell size
+static const double NODE_MATCH_DIST_SQUARED = 1.0e-7;
+static const double NODE_HASH_CELL = sqrt( NODE_MATCH_DIST_SQUARED );
+
 
 
 Mesh::Mesh()
@@ -37,6 +42,9 @@ Mesh::Mesh()
 
     m_Surf = NULL;
     m_GridDensity = NULL;
+
+    m_NodeHashValid = false;
+    m_UseRemeshQueue = false;
 }
 
 Mesh::~Mesh()
@@ -50,26 +58,28 @@ void Mesh::Clear()
     list< Face* >::iterator f;
     for ( f = faceList.begin() ; f != faceList.end(); ++f )
     {
-        delete ( *f );
+        facePool.Delete( *f );
     }
 
-    faceList.clear();
+    spareFaceList.splice( spareFaceList.end(), faceList );
 
     list< Edge* >::iterator e;
     for ( e = edgeList.begin() ; e != edgeList.end(); ++e )
     {
-        delete ( *e );
+        edgePool.Delete( *e );
     }
 
-    edgeList.clear();
+    spareEdgeList.splice( spareEdgeList.end(), edgeList );
 
     list< Node* >::iterator n;
     for ( n = nodeList.begin() ; n != nodeList.end(); ++n )
     {
-        delete ( *n );
+        nodePool.Delete( *n );
     }
 
-    nodeList.clear();
+    spareNodeList.splice( spareNodeList.end(), nodeList );
+
+    InvalidateNodeHash();
 }
 
 void Mesh::LimitTargetEdgeLength( Node* n )
@@ -181,11 +191,13 @@ void Mesh::LimitTargetEdgeLength()
 }
 
 
-void Mesh::Remesh()
+RemeshStats Mesh::Remesh()
 {
     int num_split = 1;
     int num_collapse = 1;
 
+    m_RemeshStats = RemeshStats();
+
     //==== Find Target Edge Lengths ====//
     list< Edge* >::iterator e;
     for ( e = edgeList.begin() ; e != edgeList.end(); ++e )
@@ -196,8 +208,19 @@ void Mesh::Remesh()
 
     LimitTargetEdgeLength();
 
-    for ( int i = 0 ; i < 20 ; i++ )
+    //==== First Pass Checks Every Edge, Later Passes Only The Work Queue ====//
+    m_RemeshQueue.clear();
+    m_RemeshQueue.reserve( edgeList.size() );
+    m_UseRemeshQueue = true;
+    for ( e = edgeList.begin() ; e != edgeList.end(); ++e )
+    {
+        QueueRemeshEdge( *e );
+    }
+
+    for ( int i = 0 ; i < 20 && ( num_split || num_collapse ) ; i++ )
     {
+        m_RemeshStats.m_NumPasses++;
+
         if ( num_split )
         {
             num_split = Split( 1 );
@@ -208,20 +231,120 @@ void Mesh::Remesh()
         }
     }
 
+    ClearRemeshQueue();
+
     for ( e = edgeList.begin() ; e != edgeList.end() ; ++e )
     {
         if ( !( *e )->border )
         {
-            SwapEdge( *e );
+            if ( SwapEdge( *e ) )
+            {
+                m_RemeshStats.m_NumSwap++;
+            }
         }
     }
 //printf("Smooth\n");
     LaplacianSmooth( 2 );
 
+    ComputeRemeshError( m_RemeshStats );
+
+    return m_RemeshStats;
+
     //ColorTris();
 
 }
 
+
+void Mesh::GetRemeshCandidates( vector< Edge* > & edges )
+{
+    if ( m_UseRemeshQueue )
+    {
+        edges = m_RemeshQueue;
+    }
+    else
+    {
+        edges.assign( edgeList.begin(), edgeList.end() );
+    }
+}
+
+void Mesh::QueueRemeshEdge( Edge* e )
+{
+    if ( m_UseRemeshQueue && !e->m_QueuedFlag )
+    {
+        e->m_QueuedFlag = true;
+        m_RemeshQueue.push_back( e );
+    }
+}
+
+// Must be called before DumpGarbage so no deleted edges are left in the queue
+void Mesh::PruneRemeshQueue()
+{
+    int num_keep = 0;
+    for ( int i = 0 ; i < ( int )m_RemeshQueue.size() ; i++ )
+    {
+        Edge* e = m_RemeshQueue[i];
+
+        bool keep = false;
+        if ( !e->m_DeleteMeFlag )
+        {
+            double rat = e->GetLength() / e->target_len;
+            keep = ( rat > 1.41 || rat < 0.707 );
+        }
+
+        if ( keep )
+        {
+            m_RemeshQueue[ num_keep ] = e;
+            num_keep++;
+        }
+        else
+        {
+            e->m_QueuedFlag = false;
+        }
+    }
+    m_RemeshQueue.resize( num_keep );
+}
+
+void Mesh::ClearRemeshQueue()
+{
+    for ( int i = 0 ; i < ( int )m_RemeshQueue.size() ; i++ )
+    {
+        m_RemeshQueue[i]->m_QueuedFlag = false;
+    }
+    m_RemeshQueue.clear();
+    m_UseRemeshQueue = false;
+}
+
+void Mesh::ComputeRemeshError( RemeshStats & stats )
+{
+    int num_edges = 0;
+    double sum_err = 0.0;
+    stats.m_NumBadEdges = 0;
+
+    list< Edge* >::iterator e;
+    for ( e = edgeList.begin() ; e != edgeList.end(); ++e )
+    {
+        if ( !( *e )->border && ( *e )->target_len > 0.0 )
+        {
+            double rat = ( *e )->length() / ( *e )->target_len;
+            if ( rat > 1.41 || rat < 0.707 )
+            {
+                stats.m_NumBadEdges++;
+            }
+            if ( rat > 0.0 )
+            {
+                sum_err += fabs( log( rat ) );
+            }
+            num_edges++;
+        }
+    }
+
+    stats.m_LenError = 0.0;
+    if ( num_edges > 0 )
+    {
+        stats.m_LenError = sum_err / ( double )num_edges;
+    }
+}
+
 void Mesh::LoadSimpFaces()
 {
     list< Face* >::iterator f;
@@ -374,20 +497,22 @@ int Mesh::CheckDupOrAdd( int ind, map< int, vector< int > > & indMap, vector< ve
 int Mesh::Split( int num_iter )
 {
     int num_long_edges = 0;
-    list< Edge* >::iterator e;
     for ( int iter = 0 ; iter < num_iter ; iter++ )
     {
         //===== Split ====//
+        vector< Edge* > candidates;
+        GetRemeshCandidates( candidates );
+
         vector < pair < Edge*, double > > longEdges;
-        longEdges.reserve( edgeList.size() );
-        for ( e = edgeList.begin() ; e != edgeList.end(); ++e )
+        longEdges.reserve( candidates.size() );
+        for ( int i = 0 ; i < ( int )candidates.size() ; i++ )
         {
-            if ( !( *e )->border )
+            if ( !candidates[i]->border )
             {
-                double rat = ( *e )->GetLength() / ( *e )->target_len;
+                double rat = candidates[i]->GetLength() / candidates[i]->target_len;
                 if ( rat > 1.41 )
                 {
-                    longEdges.emplace_back( pair< Edge*, double >( ( *e ), rat ) );
+                    longEdges.emplace_back( pair< Edge*, double >( candidates[i], rat ) );
                 }
             }
         }
@@ -403,6 +528,7 @@ int Mesh::Split( int num_iter )
             longEdges[i].first->ComputeLength();
             SplitEdge( longEdges[i].first );
         }
+        m_RemeshStats.m_NumSplit += num_split;
 
         //==== Swap All Changed Edges If Needed ====//
         //for ( e = edgeList.begin() ; e != edgeList.end(); e++ )
@@ -411,6 +537,11 @@ int Mesh::Split( int num_iter )
         //}
 
         num_long_edges = longEdges.size();
+
+        if ( m_UseRemeshQueue )
+        {
+            PruneRemeshQueue();
+        }
     }
     DumpGarbage();
 
@@ -423,21 +554,22 @@ int Mesh::Collapse( int num_iter )
     int num_short_edges = 0;
     for ( int iter = 0 ; iter < num_iter ; iter++ )
     {
-        list< Edge* >::iterator e;
-
         //==== Collapse =====//
+        vector< Edge* > candidates;
+        GetRemeshCandidates( candidates );
+
         vector < pair < Edge*, double > > shortEdges;
-        shortEdges.reserve( edgeList.size() );
-        for ( e = edgeList.begin() ; e != edgeList.end(); ++e )
+        shortEdges.reserve( candidates.size() );
+        for ( int i = 0 ; i < ( int )candidates.size() ; i++ )
         {
-            if ( *e )
+            if ( candidates[i] )
             {
-                if ( ValidCollapse( *e ) )
+                if ( ValidCollapse( candidates[i] ) )
                 {
-                    double rat = ( *e )->GetLength() / ( *e )->target_len;
+                    double rat = candidates[i]->GetLength() / candidates[i]->target_len;
                     if ( rat < 0.707 )
                     {
-                        shortEdges.emplace_back( pair< Edge*, double >( ( *e ), rat ) );
+                        shortEdges.emplace_back( pair< Edge*, double >( candidates[i], rat ) );
                     }
                 }
             }
@@ -466,8 +598,14 @@ int Mesh::Collapse( int num_iter )
         //{
         //      ComputeTargetEdgeLength(*e);
         //}
-    }
 
+        m_RemeshStats.m_NumCollapse += num_short_edges;
+
+        if ( m_UseRemeshQueue )
+        {
+            PruneRemeshQueue();
+        }
+    }
     DumpGarbage();
 
     return num_short_edges;
@@ -551,38 +689,131 @@ void Mesh::ColorTris()
 
 Node* Mesh::AddNode( vec3d p, vec2d uw_in )
 {
-    Node* nptr = new Node( p, uw_in );
-    nodeList.push_back( nptr );
+    Node* nptr = nodePool.New( p, uw_in );
+
+    if ( spareNodeList.empty() )
+    {
+        nodeList.push_back( nptr );
+    }
+    else
+    {
+        nodeList.splice( nodeList.end(), spareNodeList, spareNodeList.begin() );
+        nodeList.back() = nptr;
+    }
     nptr->list_ptr = --nodeList.end();
+
+    if ( m_NodeHashValid )
+    {
+        m_NodeHash[ NodeHashCell( nptr->pnt ) ].push_back( nptr );
+    }
+
     return nptr;
 }
 
 void Mesh::RemoveNode( Node* nptr )
 {
+    if ( m_NodeHashValid )
+    {
+        vector< Node* > & cell = m_NodeHash[ NodeHashCell( nptr->pnt ) ];
+        for ( int i = 0 ; i < ( int )cell.size() ; i++ )
+        {
+            if ( cell[i] == nptr )
+            {
+                cell[i] = cell.back();
+                cell.pop_back();
+                break;
+            }
+        }
+    }
+
     garbageNodeVec.push_back( nptr );
-    nodeList.erase( nptr->list_ptr );
+    spareNodeList.splice( spareNodeList.end(), nodeList, nptr->list_ptr );
 
     nptr->m_DeleteMeFlag = true;
 }
 
 Node* Mesh::FindNode( const vec3d& p )
 {
-    list< Node* >::iterator n;
-    for ( n = nodeList.begin() ; n != nodeList.end(); ++n )
+    if ( !m_NodeHashValid )
     {
-        if ( !( *n )->m_DeleteMeFlag && dist_squared( ( *n )->pnt, p ) < 1.0e-7 )
+        BuildNodeHash();
+    }
+
+    //==== Search The Cells Within Match Distance Of p ====//
+    NodeHashKey center = NodeHashCell( p );
+    NodeHashKey key;
+    for ( int i = -1 ; i <= 1 ; i++ )
+    {
+        key.m_Index[0] = center.m_Index[0] + i;
+        for ( int j = -1 ; j <= 1 ; j++ )
         {
-            return ( *n );
+            key.m_Index[1] = center.m_Index[1] + j;
+            for ( int k = -1 ; k <= 1 ; k++ )
+            {
+                key.m_Index[2] = center.m_Index[2] + k;
+
+                unordered_map< NodeHashKey, vector< Node* >, NodeHashKeyHash >::iterator c = m_NodeHash.find( key );
+                if ( c == m_NodeHash.end() )
+                {
+                    continue;
+                }
+
+                const vector< Node* > & cell = c->second;
+                for ( int n = 0 ; n < ( int )cell.size() ; n++ )
+                {
+                    if ( !cell[n]->m_DeleteMeFlag && dist_squared( cell[n]->pnt, p ) < NODE_MATCH_DIST_SQUARED )
+                    {
+                        return cell[n];
+                    }
+                }
+            }
         }
     }
     return NULL;
 }
 
+NodeHashKey Mesh::NodeHashCell( const vec3d& p )
+{
+    NodeHashKey key;
+    key.m_Index[0] = ( long long )floor( p.x() / NODE_HASH_CELL );
+    key.m_Index[1] = ( long long )floor( p.y() / NODE_HASH_CELL );
+    key.m_Index[2] = ( long long )floor( p.z() / NODE_HASH_CELL );
+    return key;
+}
+
+void Mesh::BuildNodeHash()
+{
+    m_NodeHash.clear();
+    m_NodeHash.reserve( nodeList.size() );
+
+    list< Node* >::iterator n;
+    for ( n = nodeList.begin() ; n != nodeList.end(); ++n )
+    {
+        m_NodeHash[ NodeHashCell( ( *n )->pnt ) ].push_back( *n );
+    }
+
+    m_NodeHashValid = true;
+}
+
+void Mesh::InvalidateNodeHash()
+{
+    m_NodeHash.clear();
+    m_NodeHashValid = false;
+}
+
 Edge* Mesh::AddEdge( Node* n0, Node* n1 )
 {
-    Edge* eptr = new Edge( n0, n1 );
+    Edge* eptr = edgePool.New( n0, n1 );
 
-    edgeList.push_back( eptr );
+    if ( spareEdgeList.empty() )
+    {
+        edgeList.push_back( eptr );
+    }
+    else
+    {
+        edgeList.splice( edgeList.end(), spareEdgeList, spareEdgeList.begin() );
+        edgeList.back() = eptr;
+    }
     eptr->list_ptr = --edgeList.end();
 
     n0->AddConnectEdge( eptr );
@@ -590,6 +821,8 @@ Edge* Mesh::AddEdge( Node* n0, Node* n1 )
 
     eptr->ComputeLength();
 
+    QueueRemeshEdge( eptr );
+
     return eptr;
 }
 
@@ -608,7 +841,7 @@ void Mesh::RemoveEdge( Edge* eptr )
 
         garbageEdgeVec.push_back( eptr );
 
-        edgeList.erase( eptr->list_ptr );
+        spareEdgeList.splice( spareEdgeList.end(), edgeList, eptr->list_ptr );
 
         eptr->m_DeleteMeFlag = true;
     }
@@ -616,28 +849,23 @@ void Mesh::RemoveEdge( Edge* eptr )
 
 Edge* Mesh::FindEdge( Node* n0, Node* n1 )
 {
-    list< Edge* >::iterator e;
-    for ( e = edgeList.begin() ; e != edgeList.end(); ++e )
-    {
-        if ( !( *e )->m_DeleteMeFlag )
-        {
-            if ( ( *e )->n0 == n0 && ( *e )->n1 == n1 )
-            {
-                return ( *e );
-            }
-            if ( ( *e )->n0 == n1 && ( *e )->n1 == n0 )
-            {
-                return ( *e );
-            }
-        }
-    }
-    return NULL;
+    // Removed edges are dropped from the node connectivity, so only n0's edges need checking
+    return n0->FindEdge( n1 );
 }
 
 Face* Mesh::AddFace( Node* nn0, Node* nn1, Node* nn2, Edge* ee0, Edge* ee1, Edge* ee2 )
 {
-    Face* fptr = new Face( nn0, nn1, nn2, ee0, ee1, ee2 );
-    faceList.push_back( fptr );
+    Face* fptr = facePool.New( nn0, nn1, nn2, ee0, ee1, ee2 );
+
+    if ( spareFaceList.empty() )
+    {
+        faceList.push_back( fptr );
+    }
+    else
+    {
+        faceList.splice( faceList.end(), spareFaceList, spareFaceList.begin() );
+        faceList.back() = fptr;
+    }
     fptr->list_ptr = --faceList.end();
 
     ee0->SetFace( fptr );
@@ -649,8 +877,17 @@ Face* Mesh::AddFace( Node* nn0, Node* nn1, Node* nn2, Edge* ee0, Edge* ee1, Edge
 
 Face* Mesh::AddFace( Node* nn0, Node* nn1, Node* nn2, Node* nn3, Edge* ee0, Edge* ee1, Edge* ee2, Edge* ee3 )
 {
-    Face* fptr = new Face( nn0, nn1, nn2, nn3, ee0, ee1, ee2, ee3 );
-    faceList.push_back( fptr );
+    Face* fptr = facePool.New( nn0, nn1, nn2, nn3, ee0, ee1, ee2, ee3 );
+
+    if ( spareFaceList.empty() )
+    {
+        faceList.push_back( fptr );
+    }
+    else
+    {
+        faceList.splice( faceList.end(), spareFaceList, spareFaceList.begin() );
+        faceList.back() = fptr;
+    }
     fptr->list_ptr = --faceList.end();
 
     ee0->SetFace( fptr );
@@ -666,7 +903,7 @@ void Mesh::RemoveFace( Face* fptr )
     if ( fptr && ! fptr->m_DeleteMeFlag )
     {
         garbageFaceVec.push_back( fptr );
-        faceList.erase( fptr->list_ptr );
+        spareFaceList.splice( spareFaceList.end(), faceList, fptr->list_ptr );
         fptr->m_DeleteMeFlag = true;
         fptr->EdgeForgetFace();
     }
@@ -677,21 +914,21 @@ void Mesh::DumpGarbage()
     //==== Delete Flagged Nodes =====//
     for ( int i = 0 ; i < ( int )garbageNodeVec.size() ; i++ )
     {
-        delete garbageNodeVec[i];
+        nodePool.Delete( garbageNodeVec[i] );
     }
     garbageNodeVec.clear();
 
     //==== Delete Flagged Edges =====//
     for ( int i = 0 ; i < ( int )garbageEdgeVec.size() ; i++ )
     {
-        delete garbageEdgeVec[i];
+        edgePool.Delete( garbageEdgeVec[i] );
     }
     garbageEdgeVec.clear();
 
     //==== Delete Flagged Faces =====//
     for ( int i = 0 ; i < ( int )garbageFaceVec.size() ; i++ )
     {
-        delete garbageFaceVec[i];
+        facePool.Delete( garbageFaceVec[i] );
     }
     garbageFaceVec.clear();
 }
@@ -806,13 +1043,13 @@ void Mesh::SplitEdge( Edge* edge )
     LimitTargetEdgeLength( ns );
 }
 
-void Mesh::SwapEdge( Edge* edge )
+bool Mesh::SwapEdge( Edge* edge )
 {
     //if ( edge->n0->fixed && edge->n1->fixed )
-    //  return;
+    //  return false;
     if ( edge->border )
     {
-        return;
+        return false;
     }
 
     Face*  fa = edge->f0;
@@ -820,12 +1057,12 @@ void Mesh::SwapEdge( Edge* edge )
 
     if ( !fa || !fb )
     {
-        return;
+        return false;
     }
 
     if ( ThreeEdgesThreeFaces( edge ) )
     {
-        return;
+        return false;
     }
 
     Node* n0 = edge->n0;
@@ -851,7 +1088,7 @@ void Mesh::SwapEdge( Edge* edge )
 
     if ( min( qc, qd ) <= min( qa, qb ) )
     {
-        return;
+        return false;
     }
 
     vec3d norma = fa->Normal();
@@ -863,21 +1100,21 @@ void Mesh::SwapEdge( Edge* edge )
 
     if ( angab > 0.25 * M_PI_4  )
     {
-        return;
+        return false;
     }
 
     double angcd = angle( normc, normd );
 
     if ( angcd > 0.25 * M_PI_4  )
     {
-        return;
+        return false;
     }
 
     double angac = angle( norma, normc );
 
     if ( angac > 0.25 * M_PI_4 )
     {
-        return;
+        return false;
     }
 
     Edge* ea0 = fa->FindEdge( n0, na );
@@ -885,7 +1122,7 @@ void Mesh::SwapEdge( Edge* edge )
     Edge* eb0 = fb->FindEdge( n0, nb );
     Edge* eb1 = fb->FindEdge( nb, n1 );
 
-    if ( !ea0 || !ea1 || !eb0 || !eb1 ) return;
+    if ( !ea0 || !ea1 || !eb0 || !eb1 ) return false;
 
     edge->n0 = na;
     edge->n1 = nb;
@@ -929,6 +1166,7 @@ void Mesh::SwapEdge( Edge* edge )
     LimitTargetEdgeLength( edge );
 
 //CheckValidAllEdges();
+    return true;
 }
 
 bool Mesh::ThreeEdgesThreeFaces( Edge* edge )
@@ -1329,12 +1567,20 @@ void Mesh::CollapseEdge( Edge* edge )
     ComputeTargetEdgeLength( nc );
     LimitTargetEdgeLength( nc );
 
+    //==== Edges Moved To nc Have New Lengths And Targets ====//
+    for ( int i = 0 ; i < ( int )nc->edgeVec.size() ; i++ )
+    {
+        QueueRemeshEdge( nc->edgeVec[i] );
+    }
+
 //CheckValidAllEdges( );
 
 }
 
 void Mesh::LaplacianSmooth( int num_iter )
 {
+    InvalidateNodeHash();
+
     for ( int i = 0 ; i < num_iter ; i++ )
     {
         list< Node* >::iterator n;
@@ -1357,6 +1603,8 @@ void Mesh::LaplacianSmooth( int num_iter )
 
 void Mesh::OptSmooth( int num_iter )
 {
+    InvalidateNodeHash();
+
     for ( int i = 0 ; i < num_iter ; i++ )
     {
         list< Node* >::iterator n;
@@ -1372,6 +1620,8 @@ void Mesh::OptSmooth( int num_iter )
 
 bool Mesh::SetFixPoint( const vec3d &fix_pnt, vec2d fix_uw )
 {
+    InvalidateNodeHash();
+
     double min_dist = DBL_MAX;
     Node* closest_node = NULL;
 
@@ -1410,6 +1660,8 @@ bool Mesh::SetFixPoint( const vec3d &fix_pnt, vec2d fix_uw )
 
 void Mesh::AdjustEdgeLengths()
 {
+    InvalidateNodeHash();
+
     //==== Find Avg Edge Length ====//
     double avg_length = 0.0;
     list< Edge* >::iterator e;
@@ -2574,6 +2826,315 @@ void Mesh::ConvertToQuads()
     DumpGarbage();
 }
 
+void Mesh::SaveSnapshot( MeshSnapshot & snap )
+{
+    snap = MeshSnapshot();
+
+    //==== Index Nodes, Edges And Faces By List Order ====//
+    unordered_map< Node*, int > node_index;
+    unordered_map< Edge*, int > edge_index;
+    unordered_map< Face*, int > face_index;
+
+    list< Node* >::iterator n;
+    for ( n = nodeList.begin() ; n != nodeList.end(); ++n )
+    {
+        int ind = node_index.size();
+        node_index[ *n ] = ind;
+    }
+
+    list< Edge* >::iterator e;
+    for ( e = edgeList.begin() ; e != edgeList.end(); ++e )
+    {
+        int ind = edge_index.size();
+        edge_index[ *e ] = ind;
+    }
+
+    list< Face* >::iterator f;
+    for ( f = faceList.begin() ; f != faceList.end(); ++f )
+    {
+        int ind = face_index.size();
+        face_index[ *f ] = ind;
+    }
+
+    face_index[ ( Face* )NULL ] = -1;
+    edge_index[ ( Edge* )NULL ] = -1;
+
+    //==== Nodes ====//
+    snap.m_NodePnt.reserve( nodeList.size() );
+    snap.m_NodeUW.reserve( nodeList.size() );
+    snap.m_NodeFixed.reserve( nodeList.size() );
+    snap.m_NodeEdges.resize( nodeList.size() );
+    int i = 0;
+    for ( n = nodeList.begin() ; n != nodeList.end(); ++n )
+    {
+        snap.m_NodePnt.push_back( ( *n )->pnt );
+        snap.m_NodeUW.push_back( ( *n )->uw );
+        snap.m_NodeFixed.push_back( ( *n )->fixed );
+
+        for ( int j = 0 ; j < ( int )( *n )->edgeVec.size() ; j++ )
+        {
+            snap.m_NodeEdges[i].push_back( edge_index[ ( *n )->edgeVec[j] ] );
+        }
+        i++;
+    }
+
+    //==== Edges ====//
+    for ( e = edgeList.begin() ; e != edgeList.end(); ++e )
+    {
+        snap.m_EdgeNodes.push_back( node_index[ ( *e )->n0 ] );
+        snap.m_EdgeNodes.push_back( node_index[ ( *e )->n1 ] );
+        snap.m_EdgeFaces.push_back( face_index[ ( *e )->f0 ] );
+        snap.m_EdgeFaces.push_back( face_index[ ( *e )->f1 ] );
+
+        unordered_map< Node*, int >::iterator ns = node_index.find( ( *e )->ns );
+        snap.m_EdgeSplitNode.push_back( ns != node_index.end() ? ns->second : -1 );
+
+        snap.m_EdgeBorder.push_back( ( *e )->border );
+        snap.m_EdgeRidge.push_back( ( *e )->ridge );
+        snap.m_EdgeTargetLen.push_back( ( *e )->target_len );
+        snap.m_EdgeLength.push_back( ( *e )->m_Length );
+    }
+
+    //==== Faces ====//
+    for ( f = faceList.begin() ; f != faceList.end(); ++f )
+    {
+        snap.m_FaceNodes.push_back( node_index[ ( *f )->n0 ] );
+        snap.m_FaceNodes.push_back( node_index[ ( *f )->n1 ] );
+        snap.m_FaceNodes.push_back( node_index[ ( *f )->n2 ] );
+        snap.m_FaceNodes.push_back( ( *f )->n3 ? node_index[ ( *f )->n3 ] : -1 );
+
+        snap.m_FaceEdges.push_back( edge_index[ ( *f )->e0 ] );
+        snap.m_FaceEdges.push_back( edge_index[ ( *f )->e1 ] );
+        snap.m_FaceEdges.push_back( edge_index[ ( *f )->e2 ] );
+        snap.m_FaceEdges.push_back( edge_index[ ( *f )->e3 ] );
+    }
+}
+
+void Mesh::LoadSnapshot( const MeshSnapshot & snap )
+{
+    DumpGarbage();
+    Clear();
+
+    int num_nodes = snap.m_NodePnt.size();
+    int num_edges = snap.m_EdgeNodes.size() / 2;
+    int num_faces = snap.m_FaceNodes.size() / 4;
+
+    vector< Node* > nodeVec( num_nodes );
+    for ( int i = 0 ; i < num_nodes ; i++ )
+    {
+        nodeVec[i] = AddNode( snap.m_NodePnt[i], snap.m_NodeUW[i] );
+        nodeVec[i]->fixed = ( snap.m_NodeFixed[i] != 0 );
+    }
+
+    vector< Edge* > edgeVec( num_edges );
+    for ( int i = 0 ; i < num_edges ; i++ )
+    {
+        Edge* e = AddEdge( nodeVec[ snap.m_EdgeNodes[ 2 * i ] ], nodeVec[ snap.m_EdgeNodes[ 2 * i + 1 ] ] );
+
+        int ns = snap.m_EdgeSplitNode[i];
+        e->ns = ( ns >= 0 ) ? nodeVec[ ns ] : NULL;
+
+        e->border = ( snap.m_EdgeBorder[i] != 0 );
+        e->ridge = ( snap.m_EdgeRidge[i] != 0 );
+        e->target_len = snap.m_EdgeTargetLen[i];
+        e->m_Length = snap.m_EdgeLength[i];
+
+        edgeVec[i] = e;
+    }
+
+    vector< Face* > faceVec( num_faces );
+    for ( int i = 0 ; i < num_faces ; i++ )
+    {
+        const int* fn = &snap.m_FaceNodes[ 4 * i ];
+        const int* fe = &snap.m_FaceEdges[ 4 * i ];
+
+        if ( fn[3] < 0 )
+        {
+            faceVec[i] = AddFace( nodeVec[ fn[0] ], nodeVec[ fn[1] ], nodeVec[ fn[2] ],
+                                  edgeVec[ fe[0] ], edgeVec[ fe[1] ], edgeVec[ fe[2] ] );
+        }
+        else
+        {
+            faceVec[i] = AddFace( nodeVec[ fn[0] ], nodeVec[ fn[1] ], nodeVec[ fn[2] ], nodeVec[ fn[3] ],
+                                  edgeVec[ fe[0] ], edgeVec[ fe[1] ], edgeVec[ fe[2] ], edgeVec[ fe[3] ] );
+        }
+    }
+
+    //==== Restore Connection Order Left By Remesh ====//
+    for ( int i = 0 ; i < num_edges ; i++ )
+    {
+        int f0 = snap.m_EdgeFaces[ 2 * i ];
+        int f1 = snap.m_EdgeFaces[ 2 * i + 1 ];
+        edgeVec[i]->f0 = ( f0 >= 0 ) ? faceVec[ f0 ] : NULL;
+        edgeVec[i]->f1 = ( f1 >= 0 ) ? faceVec[ f1 ] : NULL;
+    }
+
+    for ( int i = 0 ; i < num_nodes ; i++ )
+    {
+        const vector< int > & ne = snap.m_NodeEdges[i];
+        nodeVec[i]->edgeVec.resize( ne.size() );
+        for ( int j = 0 ; j < ( int )ne.size() ; j++ )
+        {
+            nodeVec[i]->edgeVec[j] = edgeVec[ ne[j] ];
+        }
+    }
+}
+
+void MeshSnapshot::HashState( std::size_t & seed ) const
+{
+    hash_combine( seed, m_NodePnt.size() );
+    for ( int i = 0 ; i < ( int )m_NodePnt.size() ; i++ )
+    {
+        hash_combine( seed, m_NodePnt[i].x() );
+        hash_combine( seed, m_NodePnt[i].y() );
+        hash_combine( seed, m_NodePnt[i].z() );
+        hash_combine( seed, m_NodeUW[i].x() );
+        hash_combine( seed, m_NodeUW[i].y() );
+        hash_combine( seed, m_NodeFixed[i] );
+
+        for ( int j = 0 ; j < ( int )m_NodeEdges[i].size() ; j++ )
+        {
+            hash_combine( seed, m_NodeEdges[i][j] );
+        }
+    }
+
+    hash_combine( seed, m_EdgeSplitNode.size() );
+    for ( int i = 0 ; i < ( int )m_EdgeSplitNode.size() ; i++ )
+    {
+        hash_combine( seed, m_EdgeNodes[ 2 * i ] );
+        hash_combine( seed, m_EdgeNodes[ 2 * i + 1 ] );
+        hash_combine( seed, m_EdgeFaces[ 2 * i ] );
+        hash_combine( seed, m_EdgeFaces[ 2 * i + 1 ] );
+        hash_combine( seed, m_EdgeSplitNode[i] );
+        hash_combine( seed, m_EdgeBorder[i] );
+        hash_combine( seed, m_EdgeRidge[i] );
+        hash_combine( seed, m_EdgeTargetLen[i] );
+        hash_combine( seed, m_EdgeLength[i] );
+    }
+
+    hash_combine( seed, m_FaceNodes.size() );
+    for ( int i = 0 ; i < ( int )m_FaceNodes.size() ; i++ )
+    {
+        hash_combine( seed, m_FaceNodes[i] );
+        hash_combine( seed, m_FaceEdges[i] );
+    }
+}
+
+bool MeshSnapshot::operator==( const MeshSnapshot & s ) const
+{
+    if ( m_NodePnt.size() != s.m_NodePnt.size() || m_NodeUW.size() != s.m_NodeUW.size() )
+    {
+        return false;
+    }
+
+    for ( int i = 0 ; i < ( int )m_NodePnt.size() ; i++ )
+    {
+        if ( m_NodePnt[i].x() != s.m_NodePnt[i].x() ||
+             m_NodePnt[i].y() != s.m_NodePnt[i].y() ||
+             m_NodePnt[i].z() != s.m_NodePnt[i].z() )
+        {
+            return false;
+        }
+    }
+
+    for ( int i = 0 ; i < ( int )m_NodeUW.size() ; i++ )
+    {
+        if ( m_NodeUW[i].x() != s.m_NodeUW[i].x() || m_NodeUW[i].y() != s.m_NodeUW[i].y() )
+        {
+            return false;
+        }
+    }
+
+    return m_NodeFixed == s.m_NodeFixed &&
+           m_NodeEdges == s.m_NodeEdges &&
+           m_EdgeNodes == s.m_EdgeNodes &&
+           m_EdgeFaces == s.m_EdgeFaces &&
+           m_EdgeSplitNode == s.m_EdgeSplitNode &&
+           m_EdgeBorder == s.m_EdgeBorder &&
+           m_EdgeRidge == s.m_EdgeRidge &&
+           m_EdgeTargetLen == s.m_EdgeTargetLen &&
+           m_EdgeLength == s.m_EdgeLength &&
+           m_FaceNodes == s.m_FaceNodes &&
+           m_FaceEdges == s.m_FaceEdges;
+}
+
+std::size_t RemeshInput::Hash() const
+{
+    std::size_t seed = 0;
+
+    hash_combine( seed, m_SurfState.size() );
+    for ( int i = 0 ; i < ( int )m_SurfState.size() ; i++ )
+    {
+        hash_combine( seed, m_SurfState[i] );
+    }
+
+    hash_combine( seed, m_NumMap );
+    hash_combine( seed, m_SrcStr.size() );
+    for ( int i = 0 ; i < ( int )m_SrcStr.size() ; i++ )
+    {
+        hash_combine( seed, m_SrcStr[i] );
+    }
+
+    hash_combine( seed, m_GrowRatio );
+    hash_combine( seed, m_MinLen );
+
+    m_Mesh.HashState( seed );
+
+    return seed;
+}
+
+bool RemeshInput::operator==( const RemeshInput & in ) const
+{
+    return m_NumMap == in.m_NumMap &&
+           m_GrowRatio == in.m_GrowRatio &&
+           m_MinLen == in.m_MinLen &&
+           m_SurfState == in.m_SurfState &&
+           m_SrcStr == in.m_SrcStr &&
+           m_Mesh == in.m_Mesh;
+}
+
+RemeshCache::RemeshCache()
+{
+    m_NumReused = 0;
+}
+
+const MeshSnapshot* RemeshCache::Find( const RemeshInput & input ) const
+{
+    unordered_map< std::size_t, RemeshCacheEntry >::const_iterator it = m_PrevMap.find( input.Hash() );
+    if ( it == m_PrevMap.end() )
+    {
+        return NULL;
+    }
+
+    //==== Matching Hash Is Not Enough - Inputs Must Be Identical ====//
+    if ( !( it->second.m_Input == input ) )
+    {
+        return NULL;
+    }
+    return &it->second.m_Result;
+}
+
+void RemeshCache::Store( const RemeshInput & input, Mesh* mesh )
+{
+    RemeshCacheEntry & entry = m_NextMap[ input.Hash() ];
+    entry.m_Input = input;
+    mesh->SaveSnapshot( entry.m_Result );
+}
+
+void RemeshCache::FinishRun( int num_reused )
+{
+    m_PrevMap.swap( m_NextMap );
+    m_NextMap.clear();
+    m_NumReused = num_reused;
+}
+
+void RemeshCache::Clear()
+{
+    m_PrevMap.clear();
+    m_NextMap.clear();
+    m_NumReused = 0;
+}
+
 /*
 void Mesh::Draw()
 {
@@ -14,6 +14,7 @@
 #include "Vec2d.h"
 #include "Vec3d.h"
 #include "Face.h"
+#include "MeshPool.h"
 
 class Surf;
 class SimpleGridDensity;
@@ -29,6 +30,7 @@ class SurfaceIntersectionSingleton;
 
 #include <vector>
 #include <list>
+#include <unordered_map>
 using namespace std;
 
 
@@ -39,6 +41,93 @@ public:
     vec2d m_UWmid;
 };
 
+// Convergence measures from one call to Mesh::Remesh
+class RemeshStats
+{
+public:
+    RemeshStats()
+    {
+        m_NumPasses = m_NumSplit = m_NumCollapse = m_NumSwap = m_NumBadEdges = 0;
+        m_LenError = 0.0;
+    }
+
+    int NumTopoChanges() const
+    {
+        return m_NumSplit + m_NumCollapse + m_NumSwap;
+    }
+
+    int m_NumPasses;            // Split/collapse passes run
+    int m_NumSplit;
+    int m_NumCollapse;
+    int m_NumSwap;
+
+    int m_NumBadEdges;          // Interior edges still outside the split/collapse length ratios
+    double m_LenError;          // Mean |log( length / target )| over interior edges
+};
+
+// Copy of a Mesh's nodes, edges and faces with pointers replaced by list index.
+// Restoring a snapshot rebuilds the lists, connectivity and face order exactly.
+class MeshSnapshot
+{
+public:
+    void HashState( std::size_t & seed ) const;
+
+    // Exact match of every node, edge and face
+    bool operator==( const MeshSnapshot & s ) const;
+
+    vector< vec3d > m_NodePnt;
+    vector< vec2d > m_NodeUW;
+    vector< char > m_NodeFixed;
+    vector< vector< int > > m_NodeEdges;    // Node edgeVec, in order
+
+    vector< int > m_EdgeNodes;              // n0, n1 per edge
+    vector< int > m_EdgeFaces;              // f0, f1 per edge, -1 if none
+    vector< int > m_EdgeSplitNode;          // ns, -1 if none
+    vector< char > m_EdgeBorder;
+    vector< char > m_EdgeRidge;
+    vector< double > m_EdgeTargetLen;
+    vector< double > m_EdgeLength;
+
+    vector< int > m_FaceNodes;              // n0 - n3 per face, n3 is -1 for tris
+    vector< int > m_FaceEdges;              // e0 - e3 per face, e3 is -1 for tris
+};
+
+// Everything Remesh reads from a surface (see Surf::GetRemeshInput).
+class RemeshInput
+{
+public:
+    std::size_t Hash() const;
+    bool operator==( const RemeshInput & in ) const;
+
+    vector< double > m_SurfState;           // Parameterization, degrees and control points
+    vector< double > m_SrcStr;              // Target length map, each row led by its size
+    int m_NumMap;
+    double m_GrowRatio;
+    double m_MinLen;
+    MeshSnapshot m_Mesh;                    // Mesh before Remesh
+};
+
+// Cell of the spatial hash used by Mesh::FindNode
+class NodeHashKey
+{
+public:
+    long long m_Index[3];
+
+    bool operator==( const NodeHashKey& k ) const
+    {
+        return m_Index[0] == k.m_Index[0] && m_Index[1] == k.m_Index[1] && m_Index[2] == k.m_Index[2];
+    }
+};
+
+class NodeHashKeyHash
+{
+public:
+    size_t operator()( const NodeHashKey& k ) const
+    {
+        return ( size_t )( k.m_Index[0] * 73856093LL ^ k.m_Index[1] * 19349663LL ^ k.m_Index[2] * 83492791LL );
+    }
+};
+
 //////////////////////////////////////////////////////////////////////
 class Mesh
 {
@@ -51,7 +140,7 @@ public:
 
     // void Draw();
 
-    void Remesh();
+    RemeshStats Remesh();
     void LoadSimpFaces();
     void CondenseSimpFaces();
     static int CheckDupOrAdd( int ind, map< int, vector< int > > & indMap, vector< vec3d > & pntVec );
@@ -61,7 +150,7 @@ public:
     void SplitEdge( Edge* edge );
 
     static bool ThreeEdgesThreeFaces( Edge* edge );
-    void SwapEdge( Edge* edge );
+    bool SwapEdge( Edge* edge );
 
     int Collapse( int num_iter );
     static bool ValidCollapse( Edge* edge );
@@ -116,6 +205,9 @@ public:
 
     void ConvertToQuads();
 
+    void SaveSnapshot( MeshSnapshot & snap );
+    void LoadSnapshot( const MeshSnapshot & snap );
+
     void SetSurfPtr( Surf* sptr )
     {
         m_Surf = sptr;
@@ -178,6 +270,36 @@ protected:
     vector< Edge* > garbageEdgeVec;
     vector< Node* > garbageNodeVec;
 
+    // Storage for the Nodes, Edges and Faces above.  Removed list entries are
+    // kept in the spare lists and spliced back in by the next Add call.
+    MeshPool< Face > facePool;
+    MeshPool< Edge > edgePool;
+    MeshPool< Node > nodePool;
+
+    list < Face* > spareFaceList;
+    list < Edge* > spareEdgeList;
+    list < Node* > spareNodeList;
+
+    // Work queue of edges for Split and Collapse to check during Remesh.  Holds
+    // every new or changed edge plus those still outside their length ratios.
+    void GetRemeshCandidates( vector< Edge* > & edges );
+    void QueueRemeshEdge( Edge* e );
+    void PruneRemeshQueue();
+    void ClearRemeshQueue();
+    void ComputeRemeshError( RemeshStats & stats );
+
+    bool m_UseRemeshQueue;
+    vector< Edge* > m_RemeshQueue;
+    RemeshStats m_RemeshStats;
+
+    // Spatial hash for FindNode, built on first use and dropped when nodes move
+    NodeHashKey NodeHashCell( const vec3d& p );
+    void BuildNodeHash();
+    void InvalidateNodeHash();
+
+    bool m_NodeHashValid;
+    unordered_map< NodeHashKey, vector< Node* >, NodeHashKeyHash > m_NodeHash;
+
     int m_HighlightNodeIndex;
     int m_HighlightEdgeIndex;
 
@@ -186,5 +308,44 @@ protected:
     vector< SimpFace > simpFaceVec;
 };
 
+//////////////////////////////////////////////////////////////////////
+// Remeshed surfaces from the previous run, keyed by a hash of each
+// surface's RemeshInput.  The inputs are kept with the result so a hash
+// collision can never restore another surface's mesh.
+class RemeshCacheEntry
+{
+public:
+    RemeshInput m_Input;
+    MeshSnapshot m_Result;
+};
+
+class RemeshCache
+{
+public:
+
+    RemeshCache();
+
+    // NULL if the previous run had no surface with these inputs
+    const MeshSnapshot* Find( const RemeshInput & input ) const;
+
+    // Record a remeshed surface for the next run
+    void Store( const RemeshInput & input, Mesh* mesh );
+
+    // Surfaces stored in this run replace those from the previous run
+    void FinishRun( int num_reused );
+
+    // Surfaces restored from the cache in the last run
+    int GetNumReused() const                { return m_NumReused; }
+
+    void Clear();
+
+protected:
+
+    unordered_map< std::size_t, RemeshCacheEntry > m_PrevMap;
+    unordered_map< std::size_t, RemeshCacheEntry > m_NextMap;
+
+    int m_NumReused;
+};
+
 
 #endif
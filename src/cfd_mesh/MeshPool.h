@@ -0,0 +1,99 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+//////////////////////////////////////////////////////////////////////
+// MeshPool.h
+// Block allocator for the Nodes, Edges and Faces owned by a Mesh.
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(MESH_MESHPOOL__INCLUDED_)
+#define MESH_MESHPOOL__INCLUDED_
+
+#include <vector>
+#include <new>
+#include <utility>
+using namespace std;
+
+//////////////////////////////////////////////////////////////////////
+// Objects are built in fixed size blocks that are never moved, so a pointer
+// stays valid until the object is returned with Delete().  Freed slots are
+// reused before a new block is allocated.
+template < class T >
+class MeshPool
+{
+public:
+
+    MeshPool( int block_size = 1024 )
+    {
+        m_BlockSize = block_size;
+    }
+
+    virtual ~MeshPool()
+    {
+        FreeBlocks();
+    }
+
+    template < class... Args >
+    T* New( Args&&... args )
+    {
+        if ( m_FreeVec.empty() )
+        {
+            AddBlock();
+        }
+
+        T* ptr = m_FreeVec.back();
+        m_FreeVec.pop_back();
+
+        return new ( ptr ) T( std::forward< Args >( args )... );
+    }
+
+    void Delete( T* ptr )
+    {
+        ptr->~T();
+        m_FreeVec.push_back( ptr );
+    }
+
+    // All objects must have been returned with Delete() first
+    void FreeBlocks()
+    {
+        for ( int i = 0 ; i < ( int )m_BlockVec.size() ; i++ )
+        {
+            ::operator delete( m_BlockVec[i] );
+        }
+        m_BlockVec.clear();
+        m_FreeVec.clear();
+    }
+
+    int GetNumAllocated()
+    {
+        return m_BlockSize * ( int )m_BlockVec.size() - ( int )m_FreeVec.size();
+    }
+
+private:
+
+    // Pointers into the blocks can not be shared between pools
+    MeshPool( const MeshPool& copy );
+    MeshPool& operator=( const MeshPool& copy );
+
+    void AddBlock()
+    {
+        T* block = static_cast< T* >( ::operator new( m_BlockSize * sizeof( T ) ) );
+        m_BlockVec.push_back( block );
+
+        // Reversed so slots are handed out in address order
+        m_FreeVec.reserve( m_FreeVec.size() + m_BlockSize );
+        for ( int i = m_BlockSize - 1 ; i >= 0 ; i-- )
+        {
+            m_FreeVec.push_back( block + i );
+        }
+    }
+
+    int m_BlockSize;
+
+    vector< T* > m_BlockVec;
+    vector< T* > m_FreeVec;
+};
+
+#endif
@@ -17,13 +17,13 @@ SimpleBC::SimpleBC()
     m_FeaSubSurfIndex = -1;
 }
 
-void SimpleBC::CopyFrom( FeaBC* fea_bc )
+void SimpleBC::CopyFrom( FeaBC* fea_bc, FeaMeshMgrSingleton* mesh_mgr )
 {
     m_Constraints = fea_bc->GetAsBitMask();
     m_BCType = fea_bc->m_FeaBCType();
 
-    m_FeaPartIndex = vector_find_val( FeaMeshMgr.GetMeshPtr()->m_FeaPartIDVec, fea_bc->GetPartID() );
-    m_FeaSubSurfIndex = FeaMeshMgr.GetSimpSubSurfIndex( fea_bc->GetSubSurfID() );
+    m_FeaPartIndex = vector_find_val( mesh_mgr->GetMeshPtr()->m_FeaPartIDVec, fea_bc->GetPartID() );
+    m_FeaSubSurfIndex = mesh_mgr->GetSimpSubSurfIndex( fea_bc->GetSubSurfID() );
 
     m_XLTFlag = fea_bc->m_XLTFlag();
     m_XGTFlag = fea_bc->m_XGTFlag();
@@ -45,7 +45,7 @@ void SimpleBC::CopyFrom( FeaBC* fea_bc )
 
 }
 
-void SimpleBC::ApplyTo( FeaNode* node )
+void SimpleBC::ApplyTo( FeaNode* node, int num_fea_parts )
 {
     if ( m_BCType == vsp::FEA_BC_PART )
     {
@@ -60,16 +60,13 @@ void SimpleBC::ApplyTo( FeaNode* node )
     }
     else if ( m_BCType == vsp::FEA_BC_SUBSURF )
     {
-        if ( FeaMeshMgr.GetMeshPtr() )
+        if ( node->HasTag( m_FeaSubSurfIndex + num_fea_parts ) )
         {
-            if ( node->HasTag( m_FeaSubSurfIndex + FeaMeshMgr.GetMeshPtr()->m_NumFeaParts ) )
-            {
-
-            }
-            else
-            {
-                return;
-            }
+
+        }
+        else
+        {
+            return;
         }
     }
 
@@ -9,14 +9,16 @@
 #include "FeaStructure.h"
 #include "FeaElement.h"
 
+class FeaMeshMgrSingleton;
+
 class SimpleBC
 {
 public:
     SimpleBC();
 
-    void CopyFrom( FeaBC* fea_bc );
+    void CopyFrom( FeaBC* fea_bc, FeaMeshMgrSingleton* mesh_mgr );
 
-    void ApplyTo( FeaNode* node );
+    void ApplyTo( FeaNode* node, int num_fea_parts );
 
     int m_BCType;
     BitMask m_Constraints;
@@ -257,6 +257,8 @@ SimpleFeaMeshSettings::SimpleFeaMeshSettings()
 
     m_BeamPerElementNormal = true;
 
+    m_IncrementalRemeshFlag = false;
+
     m_NodeOffset = 0;
     m_ElementOffset = 0;
 }
@@ -274,6 +276,8 @@ void SimpleFeaMeshSettings::CopyFrom( StructSettings* settings )
     m_DrawBCNodesFlag = settings->m_DrawBCNodesFlag.Get();
     m_DrawElementOrientVecFlag = settings->m_DrawElementOrientVecFlag.Get();
 
+    m_IncrementalRemeshFlag = settings->m_IncrementalRemeshFlag.Get();
+
     CopyPostOpFrom( settings );
     SimpleMeshCommonSettings::CopyFrom( settings );
 }
@@ -335,6 +339,8 @@ SimpleGridDensity::SimpleGridDensity()
     m_MaxGap = 1;
     m_FarMaxGap = 1;
     m_GrowRatio = 1;
+
+    m_SourceTreeValid = false;
 }
 
 SimpleGridDensity::~SimpleGridDensity()
@@ -354,6 +360,7 @@ void SimpleGridDensity::CopyFrom( GridDensity* gd )
     m_FarMaxGap = gd->m_FarMaxGap.Get();
     m_GrowRatio = gd->m_GrowRatio.Get();
     m_Sources = gd->GetSimpleSourceVec();
+    ClearSourceTree();
 }
 
 double SimpleGridDensity::GetRadFrac( bool farflag )
@@ -411,9 +418,39 @@ double SimpleGridDensity::GetTargetLen( vec3d& pos, bool farFlag, const string &
         base_len = m_FarMaxLen;
     }
 
-    for ( int i = 0; i < (int)m_Sources.size(); i++ )
+    if ( !m_SourceTreeValid )
     {
-        double len = m_Sources[i]->GetTargetLen( base_len, pos, geomid, surfindx, u, w );
+        for ( int i = 0; i < (int)m_Sources.size(); i++ )
+        {
+            double len = m_Sources[i]->GetTargetLen( base_len, pos, geomid, surfindx, u, w );
+            if ( len < target_len )
+            {
+                target_len = len;
+            }
+        }
+        return target_len;
+    }
+
+    vector< int > id_vec;
+    m_SourceTree.FindContaining( pos, id_vec );
+
+    // Sources outside their influence box return base_len, so they only need to be counted once.
+    if ( id_vec.size() + m_UnboundedSources.size() < m_Sources.size() )
+    {
+        target_len = base_len;
+    }
+    for ( int i = 0; i < (int)id_vec.size(); i++ )
+    {
+        double len = m_Sources[ m_SourceTreeIndex[ id_vec[i] ] ]->GetTargetLen( base_len, pos, geomid, surfindx, u, w );
+        if ( len < target_len )
+        {
+            target_len = len;
+        }
+    }
+
+    for ( int i = 0; i < (int)m_UnboundedSources.size(); i++ )
+    {
+        double len = m_Sources[ m_UnboundedSources[i] ]->GetTargetLen( base_len, pos, geomid, surfindx, u, w );
         if ( len < target_len )
         {
             target_len = len;
@@ -422,6 +459,37 @@ double SimpleGridDensity::GetTargetLen( vec3d& pos, bool farFlag, const string &
     return target_len;
 }
 
+void SimpleGridDensity::BuildSourceTree()
+{
+    ClearSourceTree();
+
+    vector< BndBox > box_vec;
+    for ( int i = 0; i < (int)m_Sources.size(); i++ )
+    {
+        BndBox box;
+        if ( m_Sources[i]->GetInfluenceBox( box ) )
+        {
+            box_vec.push_back( box );
+            m_SourceTreeIndex.push_back( i );
+        }
+        else
+        {
+            m_UnboundedSources.push_back( i );
+        }
+    }
+
+    m_SourceTree.Build( box_vec );
+    m_SourceTreeValid = true;
+}
+
+void SimpleGridDensity::ClearSourceTree()
+{
+    m_SourceTree.Clear();
+    m_SourceTreeIndex.clear();
+    m_UnboundedSources.clear();
+    m_SourceTreeValid = false;
+}
+
 void SimpleGridDensity::ScaleMesh( double scale )
 {
     m_BaseLen *= scale;
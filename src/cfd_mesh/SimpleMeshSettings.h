@@ -15,6 +15,7 @@
 #include "Vehicle.h"
 #include "MeshCommonSettings.h"
 #include "GridDensity.h"
+#include "BndBoxTree.h"
 
 using namespace std;
 
@@ -143,6 +144,8 @@ public:
 
     bool m_BeamPerElementNormal;
 
+    bool m_IncrementalRemeshFlag;
+
     unsigned long long int m_NodeOffset;
     unsigned long long int m_ElementOffset;
 
@@ -188,16 +191,23 @@ public:
     void ClearSources()
     {
         m_Sources.clear();    //Deleted in Geom
+        ClearSourceTree();
     }
     void AddSource( BaseSimpleSource* s )
     {
         m_Sources.push_back( s );
+        ClearSourceTree();
     }
     int  GetNumSources()
     {
         return m_Sources.size();
     }
 
+    // Index source influence boxes so GetTargetLen only evaluates sources that
+    // can affect a point.  Must be rebuilt after sources move or change radius.
+    void BuildSourceTree();
+    void ClearSourceTree();
+
     void ScaleMesh( double scale );
     void ScaleAllSources( double scale );
 
@@ -219,6 +229,11 @@ protected:
 
     vector< BaseSimpleSource* > m_Sources;
 
+    bool m_SourceTreeValid;
+    BndBoxTree m_SourceTree;
+    vector< int > m_SourceTreeIndex;        // m_Sources index for each box in m_SourceTree
+    vector< int > m_UnboundedSources;       // Sources without an influence box, always evaluated
+
 };
 
 class SimpleCfdGridDensity : public SimpleGridDensity
@@ -13,10 +13,12 @@
 #include "ISegChain.h"
 #include "tri_tri_intersect.h"
 #include "CfdMeshMgr.h"
+#include "StlHelper.h"
 #include "SubSurfaceMgr.h"
 #include "IntersectPatch.h"
 #include "VspUtil.h"
 #include <cfloat>  //For DBL_EPSILON
+#include <algorithm>
 #include "Vec3d.h"
 
 #ifdef DEBUG_CFD_MESH
@@ -201,8 +203,9 @@ void Surf::BuildTargetMap( vector< MapSource* > &sources, int sid )
         limitFlag = true;
     }
 
-    // Loop over surface evaluating source strength and curvature
-    for( int i = 0; i < nmapu ; i++ )
+    // Loop over surface evaluating source strength and curvature.  Map points are independent.
+    #pragma omp parallel for schedule( dynamic )
+    for( int i = 0; i < ( int )nmapu ; i++ )
     {
         double u = umin + du * ( 1.0 * i ) / ( nmapu - 1 );
         for( int j = 0; j < nmapw ; j++ )
@@ -251,6 +254,13 @@ void Surf::BuildTargetMap( vector< MapSource* > &sources, int sid )
             len = min( len, m_GridDensityPtr->GetBaseLen( limitFlag ) );
 
             m_SrcMap[i][j] = MapSource( p, len, sid, reason );
+        }
+    }
+
+    for( int i = 0; i < nmapu ; i++ )
+    {
+        for( int j = 0; j < nmapw ; j++ )
+        {
             sources.push_back( &( m_SrcMap[i][j] ) );
         }
     }
@@ -526,6 +536,32 @@ double Surf::InterpTargetMap( double u, double w, int &reason )
     return t;
 }
 
+void Surf::GetRemeshInput( RemeshInput & input )
+{
+    m_SurfCore.GetState( input.m_SurfState );
+
+    input.m_NumMap = m_NumMap;
+    input.m_SrcStr.clear();
+    for ( int i = 0 ; i < ( int )m_SrcMap.size() ; i++ )
+    {
+        input.m_SrcStr.push_back( m_SrcMap[i].size() );
+        for ( int j = 0 ; j < ( int )m_SrcMap[i].size() ; j++ )
+        {
+            input.m_SrcStr.push_back( m_SrcMap[i][j].m_str );
+        }
+    }
+
+    input.m_GrowRatio = 0.0;
+    input.m_MinLen = 0.0;
+    if ( m_GridDensityPtr )
+    {
+        input.m_GrowRatio = m_GridDensityPtr->m_GrowRatio;
+        input.m_MinLen = m_GridDensityPtr->m_MinLen;
+    }
+
+    m_Mesh.SaveSnapshot( input.m_Mesh );
+}
+
 void Surf::UWtoTargetMapij( double u, double w, int &i, int &j, double &fraci, double &fracj )
 {
     int npatchu = m_SurfCore.GetNumUPatches();
@@ -759,43 +795,42 @@ void Surf::WriteSTL( const char* filename )
     m_Mesh.WriteSimpleSTL( filename );
 }
 
-void Surf::Intersect( Surf* surfPtr, SurfaceIntersectionSingleton *MeshMgr )
+// Surface level tests that must run before patch intersection.  Coplanar border curves found here
+// are added to the mesh manager, so this is not safe to call concurrently.
+bool Surf::IntersectCheck( Surf* surfPtr, SurfaceIntersectionSingleton *MeshMgr )
 {
-    int i;
-
     if ( surfPtr->GetCompID() == m_CompID )
     {
-        return;
+        return false;
     }
 
     if ( !Compare( m_BBox, surfPtr->GetBBox() ) )
     {
-        return;
+        return false;
     }
     if ( BorderCurveOnSurface( surfPtr, MeshMgr ) )
     {
-        return;
+        return false;
     }
     if ( surfPtr->BorderCurveOnSurface( this, MeshMgr ) )
     {
-        return;
+        return false;
     }
+    return true;
+}
 
-    vector< SurfPatch* > otherPatchVec = surfPtr->GetPatchVec();
-    for ( i = 0 ; i < ( int )m_PatchVec.size() ; i++ )
-        if ( Compare( *m_PatchVec[i]->get_bbox(), surfPtr->GetBBox() ) )
-        {
-            for ( int j = 0 ; j < ( int )otherPatchVec.size() ; j++ )
-            {
-                if ( Compare( *m_PatchVec[i]->get_bbox(), *otherPatchVec[j]->get_bbox() ) )
-                {
-                    intersect( *m_PatchVec[i], *otherPatchVec[j], MeshMgr );
-                }
-            }
-        }
+// Intersect a single patch against the listed patches of surfPtr.  Only reads surface data, so
+// calls for different patches or surface pairs may run concurrently.
+void Surf::IntersectPatch( int ipatch, Surf* surfPtr, const vector< int > & other_patches, vector< PatchISeg > & isegs ) const
+{
+    const vector< SurfPatch* > & otherPatchVec = surfPtr->GetPatchVec();
+    for ( int j = 0 ; j < ( int )other_patches.size() ; j++ )
+    {
+        intersect( *m_PatchVec[ipatch], *otherPatchVec[ other_patches[j] ], isegs );
+    }
 }
 
-void Surf::IntersectLineSeg( vec3d & p0, vec3d & p1, vector< double > & t_vals )
+void Surf::IntersectLineSeg( vec3d & p0, vec3d & p1, vector< double > & t_vals ) const
 {
     BndBox line_box;
     line_box.Update( p0 );
@@ -806,10 +841,38 @@ void Surf::IntersectLineSeg( vec3d & p0, vec3d & p1, vector< double > & t_vals )
         return;
     }
 
+    if ( m_PatchTree.GetNumBoxes() == 0 || m_PatchTree.GetNumBoxes() != ( int )m_PatchVec.size() )
+    {
+        for ( int i = 0 ; i < ( int )m_PatchVec.size() ; i++ )
+        {
+            m_PatchVec[i]->IntersectLineSeg( p0, p1, line_box, t_vals );
+        }
+        return;
+    }
+
+    //==== Only Visit Patches Whose Box Overlaps The Segment - Same Order As Linear Scan ====//
+    vector< int > patch_ids;
+    m_PatchTree.FindOverlaps( line_box, patch_ids );
+    sort( patch_ids.begin(), patch_ids.end() );
+
+    for ( int i = 0 ; i < ( int )patch_ids.size() ; i++ )
+    {
+        m_PatchVec[ patch_ids[i] ]->IntersectLineSeg( p0, p1, line_box, t_vals );
+    }
+}
+
+//===== Build Patch Box Tree For IntersectLineSeg =====//
+// Also evaluates the cached planarity of each top level patch so that later
+// IntersectLineSeg calls only read patch state and may run concurrently.
+void Surf::BuildPatchTree()
+{
+    vector< BndBox > box_vec( m_PatchVec.size() );
     for ( int i = 0 ; i < ( int )m_PatchVec.size() ; i++ )
     {
-        m_PatchVec[i]->IntersectLineSeg( p0, p1, line_box, t_vals );
+        box_vec[i] = *m_PatchVec[i]->get_bbox();
+        m_PatchVec[i]->test_planar( 1.0e-5 );
     }
+    m_PatchTree.Build( box_vec );
 }
 
 bool Surf::BorderCurveOnSurface( Surf* surfPtr, SurfaceIntersectionSingleton *MeshMgr )
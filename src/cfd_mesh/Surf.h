@@ -17,9 +17,11 @@
 #include "Mesh.h"
 #include "SimpleMeshSettings.h"
 #include "SurfPatch.h"
+#include "IntersectPatch.h"
 #include "MapSource.h"
 #include "SurfCore.h"
 #include "TwoDNN.h"
+#include "BndBoxTree.h"
 
 #include <cassert>
 
@@ -68,6 +70,9 @@ public:
     void LimitTargetMap();
     void LimitTargetMap( const MSCloud &es_cloud, MSTree &es_tree, double minmap );
     double InterpTargetMap( double u, double w, int &reason );
+
+    // Copy of everything Remesh reads: the current mesh, surface shape, target map and growth limits
+    void GetRemeshInput( RemeshInput & input );
     void UWtoTargetMapij( double u, double w, int &i, int &j, double &fraci, double &fracj );
     void UWtoTargetMapij( double u, double w, int &i, int &j );
 
@@ -173,8 +178,10 @@ public:
         return &m_Mesh;
     }
 
-    void Intersect( Surf* surfPtr, SurfaceIntersectionSingleton *MeshMgr );
-    void IntersectLineSeg( vec3d & p0, vec3d & p1, vector< double > & t_vals );
+    bool IntersectCheck( Surf* surfPtr, SurfaceIntersectionSingleton *MeshMgr );
+    void IntersectPatch( int ipatch, Surf* surfPtr, const vector< int > & other_patches, vector< PatchISeg > & isegs ) const;
+    void IntersectLineSeg( vec3d & p0, vec3d & p1, vector< double > & t_vals ) const;
+    void BuildPatchTree();
 
     bool BorderCurveOnSurface( Surf* surfPtr, SurfaceIntersectionSingleton *MeshMgr );
     void PlaneBorderCurveIntersect( Surf* surfPtr, SCurve* brdPtr, SurfaceIntersectionSingleton *MeshMgr );
@@ -192,6 +199,7 @@ public:
     void SetPatchVec( const vector< SurfPatch* > &pvec )
     {
         m_PatchVec = pvec;
+        m_PatchTree.Clear();
     }
 
     void InitMesh( vector< ISegChain* > chains, const vector < vec2d > &adduw, SurfaceIntersectionSingleton *MeshMgr );
@@ -383,6 +391,7 @@ protected:
 
     BndBox m_BBox;
     vector< SurfPatch* > m_PatchVec;
+    BndBoxTree m_PatchTree;     // Boxes of m_PatchVec for line segment queries, see BuildPatchTree
 
     vector< SCurve* > m_SCurveVec;
 
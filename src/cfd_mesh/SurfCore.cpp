@@ -376,6 +376,48 @@ bool SurfCore::PlaneAtYZero() const
     return true;
 }
 
+//==== Flatten Parameterization And Control Points ====//
+void SurfCore::GetState( vector< double > & state ) const
+{
+    state.clear();
+
+    vector< double > upmap, vpmap;
+    m_Surface.get_pmap_uv( upmap, vpmap );
+
+    state.push_back( upmap.size() );
+    state.insert( state.end(), upmap.begin(), upmap.end() );
+    state.push_back( vpmap.size() );
+    state.insert( state.end(), vpmap.begin(), vpmap.end() );
+
+    piecewise_surface_type::index_type ip, jp, nupatch, nvpatch;
+    nupatch = m_Surface.number_u_patches();
+    nvpatch = m_Surface.number_v_patches();
+
+    for( ip = 0; ip < nupatch; ++ip )
+    {
+        for( jp = 0; jp < nvpatch; ++jp )
+        {
+            surface_patch_type::index_type icp, jcp;
+            const surface_patch_type *patch = m_Surface.get_patch( ip, jp );
+
+            state.push_back( patch->degree_u() );
+            state.push_back( patch->degree_v() );
+
+            for( icp = 0; icp <= patch->degree_u(); ++icp )
+            {
+                for( jcp = 0; jcp <= patch->degree_v(); ++jcp )
+                {
+                    surface_point_type cp;
+                    cp = patch->get_control_point( icp, jcp );
+                    state.push_back( cp.x() );
+                    state.push_back( cp.y() );
+                    state.push_back( cp.z() );
+                }
+            }
+        }
+    }
+}
+
 Bezier_curve SurfCore::GetBorderCurve( int iborder ) const
 {
     piecewise_curve_type pwc;
@@ -109,6 +109,8 @@ public:
     bool LessThanY( double val ) const;
     bool PlaneAtYZero() const;
 
+    void GetState( vector< double > & state ) const;
+
     Bezier_curve GetBorderCurve( int iborder ) const;
     void LoadBorderCurves( vector < Bezier_curve > & borderCurves ) const;
 
@@ -44,6 +44,7 @@ class Surf;
 class SurfPatch;
 class SurfaceIntersectionSingleton;
 class CfdMeshMgrSingleton;
+class PatchISeg;
 
 //////////////////////////////////////////////////////////////////////
 class SurfPatch
@@ -109,7 +110,7 @@ public:
     {
         return &bnd_box;
     }
-    friend void intersect( const SurfPatch& bp1, const SurfPatch& bp2, SurfaceIntersectionSingleton *MeshMgr );
+    friend void intersect( const SurfPatch& bp1, const SurfPatch& bp2, vector< PatchISeg > & isegs );
     void find_closest_uw( const vec3d& pnt_in, const double guess_uw[2],double uw[2] ) const;
     void find_closest_uw_planar_approx( const vec3d& pnt_in, double uw[2] ) const;
 
@@ -127,7 +128,7 @@ public:
         return sub_depth;
     }
 
-    friend void intersect_quads( const SurfPatch&  bp1, const SurfPatch& bp2, SurfaceIntersectionSingleton *MeshMgr );
+    friend void intersect_quads( const SurfPatch&  bp1, const SurfPatch& bp2, vector< PatchISeg > & isegs );
 
     vector < vec3d > GetPatchDrawLines() const;
 
@@ -11,7 +11,9 @@
 #include "VspUtil.h"
 #include "SubSurfaceMgr.h"
 #include "StringUtil.h"
+#include "BndBoxTree.h"
 #include <cfloat>  //For DBL_EPSILON
+#include <algorithm>
 
 #include "eli/geom/intersect/intersect_surface.hpp"
 
@@ -347,6 +349,8 @@ SurfaceIntersectionSingleton::SurfaceIntersectionSingleton() : ParmContainer()
 
     m_MessageName = "SurfIntersectMessage";
 
+    m_BufferOutputFlag = false;
+
 #ifdef DEBUG_CFD_MESH
     m_DebugDir  = string( "MeshDebug/" );
     mkdir( m_DebugDir.c_str(), 0777 );
@@ -637,6 +641,13 @@ void SurfaceIntersectionSingleton::addOutputText( string str, int output_type )
         str.insert( 0, buf );
 #endif
 
+        if ( m_BufferOutputFlag )
+        {
+            #pragma omp critical( SurfaceIntersection_OutputBuffer )
+            m_OutputBuffer.push_back( str );
+            return;
+        }
+
         MessageData data;
         data.m_String = m_MessageName;
         data.m_StringVec.push_back( str );
@@ -644,6 +655,21 @@ void SurfaceIntersectionSingleton::addOutputText( string str, int output_type )
     }
 }
 
+void SurfaceIntersectionSingleton::FlushOutputText()
+{
+    if ( m_OutputBuffer.empty() )
+    {
+        return;
+    }
+
+    MessageData data;
+    data.m_String = m_MessageName;
+    data.m_StringVec = m_OutputBuffer;
+    MessageMgr::getInstance().Send( "ScreenMgr", NULL, data );
+
+    m_OutputBuffer.clear();
+}
+
 void SurfaceIntersectionSingleton::FetchSurfs( vector< XferSurf > &xfersurfs )
 {
     m_Vehicle->FetchXFerSurfs( GetSettingsPtr()->m_SelectedSetIndex, GetSettingsPtr()->m_SelectedDegenSetIndex, xfersurfs );
@@ -1711,15 +1737,103 @@ void SurfaceIntersectionSingleton::Intersect()
 
     if ( GetSettingsPtr()->m_IntersectSubSurfs ) BuildSubSurfIntChains();
 
-    //==== Quad Tree Intersection - Intersection Segments Get Loaded at AddIntersectionSeg ===//
+    //==== Broad Phase - Overlapping Surface And Patch Boxes From Bounding Volume Hierarchies ===//
+    vector < BndBox > surf_box_vec( m_SurfVec.size() );
+    vector < BndBox > patch_box_vec;
+    vector < int > patch_surf_vec;
+    vector < int > patch_index_vec;
+    for ( int i = 0 ; i < ( int )m_SurfVec.size(); i++ )
+    {
+        surf_box_vec[i] = m_SurfVec[i]->GetBBox();
+
+        vector< SurfPatch* > & patch_vec = m_SurfVec[i]->GetPatchVec();
+        for ( int p = 0; p < (int) patch_vec.size(); p++ )
+        {
+            patch_box_vec.push_back( *patch_vec[p]->get_bbox() );
+            patch_surf_vec.push_back( i );
+            patch_index_vec.push_back( p );
+        }
+    }
+
+    BndBoxTree surf_tree;
+    surf_tree.Build( surf_box_vec );
+    vector < pair < int, int > > surf_pairs;
+    surf_tree.FindOverlaps( surf_pairs );
+    sort( surf_pairs.begin(), surf_pairs.end() );
+
+    BndBoxTree patch_tree;
+    patch_tree.Build( patch_box_vec );
+    vector < pair < int, int > > patch_pairs;
+    patch_tree.FindOverlaps( patch_pairs );
+
+    //==== Bucket Patch Pairs By Surface Pair (Lower Surface Index First) ====//
+    map < pair < int, int >, vector < pair < int, int > > > surf_patch_pair_map;
+    for ( int k = 0; k < (int) patch_pairs.size(); k++ )
+    {
+        int pa = patch_pairs[k].first;
+        int pb = patch_pairs[k].second;
+        if ( patch_surf_vec[pa] == patch_surf_vec[pb] )
+        {
+            continue;
+        }
+        if ( patch_surf_vec[pa] > patch_surf_vec[pb] )
+        {
+            swap( pa, pb );
+        }
+        surf_patch_pair_map[ make_pair( patch_surf_vec[pa], patch_surf_vec[pb] ) ].push_back( make_pair( patch_index_vec[pa], patch_index_vec[pb] ) );
+    }
+
+    //==== Check Surface Pairs - Border Curve Checks Modify Shared State So Run In Order ===//
+    vector < SurfPatchTask > tasks;
+    int ipair = 0;
     for ( int i = 0 ; i < ( int )m_SurfVec.size(); i++ )
     {
         snprintf( str, sizeof( str ), "Intersect %3d/%3d %s\n", i + 1, m_SurfVec.size(), m_SurfVec[i]->GetDisplayName().c_str() );
         addOutputText( str );
 
-        for ( int j = i + 1; j < (int) m_SurfVec.size(); j++ )
+        for ( ; ipair < (int) surf_pairs.size() && surf_pairs[ipair].first == i; ipair++ )
+        {
+            int j = surf_pairs[ipair].second;
+            if ( !m_SurfVec[i]->IntersectCheck( m_SurfVec[j], this ) )
+            {
+                continue;
+            }
+
+            map < pair < int, int >, vector < pair < int, int > > >::iterator it = surf_patch_pair_map.find( make_pair( i, j ) );
+            if ( it == surf_patch_pair_map.end() )
+            {
+                continue;
+            }
+
+            //==== One Task Per Patch Of Surface i - Patch Order Matches The Serial Nested Loop ====//
+            vector < pair < int, int > > & pp = it->second;
+            sort( pp.begin(), pp.end() );
+            for ( int k = 0; k < (int) pp.size(); k++ )
+            {
+                if ( k == 0 || pp[k].first != pp[k - 1].first )
+                {
+                    tasks.push_back( SurfPatchTask( i, j, pp[k].first ) );
+                }
+                tasks.back().m_OtherPatchVec.push_back( pp[k].second );
+            }
+        }
+    }
+
+    //==== Quad Tree Intersection - Each Patch Of Surface A Against Surface B Is Independent ===//
+    vector < vector < PatchISeg > > task_isegs( tasks.size() );
+
+    #pragma omp parallel for schedule( dynamic )
+    for ( int t = 0; t < (int) tasks.size(); t++ )
+    {
+        m_SurfVec[ tasks[t].m_SurfA ]->IntersectPatch( tasks[t].m_Patch, m_SurfVec[ tasks[t].m_SurfB ], tasks[t].m_OtherPatchVec, task_isegs[t] );
+    }
+
+    //==== Intersection Segments Get Loaded at AddIntersectionSeg in Task Order - Same As Serial ===//
+    for ( int t = 0; t < (int) task_isegs.size(); t++ )
+    {
+        for ( int k = 0; k < (int) task_isegs[t].size(); k++ )
         {
-            m_SurfVec[i]->Intersect( m_SurfVec[j], this );
+            AddIntersectionSeg( task_isegs[t][k] );
         }
     }
 
@@ -1759,110 +1873,33 @@ void SurfaceIntersectionSingleton::Intersect()
     // DebugWriteChains( "BuildCurves", false );
 }
 
-void SurfaceIntersectionSingleton::AddIntersectionSeg( const SurfPatch& pA, const SurfPatch& pB, const vec3d & ip0, const vec3d & ip1 )
+void SurfaceIntersectionSingleton::AddIntersectionSeg( const PatchISeg & iseg )
 {
-    double d = dist_squared( ip0, ip1 );
-    if ( d < DBL_EPSILON )
-    {
-        return;
-    }
-
-    vec2d plane_uwA0;
-    pA.find_closest_uw_planar_approx( ip0, plane_uwA0.v );
-
-    vec2d plane_uwB0;
-    pB.find_closest_uw_planar_approx( ip0, plane_uwB0.v );
-
-    vec2d plane_uwA1;
-    pA.find_closest_uw_planar_approx( ip1, plane_uwA1.v );
-
-    vec2d plane_uwB1;
-    pB.find_closest_uw_planar_approx( ip1, plane_uwB1.v );
-
-    // Intersections that lie exactly on a patch boundary will actually intersect both patches
-    // that share that boundary.  So, detect intersections that lie on the patch minimum edge
-    // and don't carry those forward.  Don't do this if the minimum parameter is zero.  I.e.
-    // there is no prior patch.
-
-    double tol = 1e-10; // Tolerance buildup due to SurfPatch::find_closest_uw_planar_approx and other inaccuracies
-
-    if ( pA.get_u_min() > 0.0 ) // if Patch A is not the very beginning of u
-    {
-        double lim = pA.get_u_min() + tol;
-        // if both points projected to A are on the starting edge of u
-        if ( plane_uwA0.v[0] <= lim && plane_uwA1.v[0] <= lim )
-        {
-            return;
-        }
-    }
-
-    if ( pB.get_u_min() > 0.0 ) // if Patch B is not the very beginning of u
-    {
-        double lim = pB.get_u_min() + tol;
-        // if both points projected to B are on the starting edge of u
-        if ( plane_uwB0.v[0] <= lim && plane_uwB1.v[0] <= lim )
-        {
-            return;
-        }
-    }
-
-    if ( pA.get_w_min() > 0.0 ) // if Patch A is not the very beginning of w
-    {
-        double lim = pA.get_w_min() + tol;
-        // if both points projected to A are on the starting edge of w
-        if ( plane_uwA0.v[1] <= lim && plane_uwA1.v[1] <= lim )
-        {
-            return;
-        }
-    }
-
-    if ( pB.get_w_min() > 0.0 ) // if Patch B is not the very beginning of w
-    {
-        double lim = pB.get_w_min() + tol;
-        // if both points projected to B are on the starting edge of w
-        if ( plane_uwB0.v[1] <= lim && plane_uwB1.v[1] <= lim )
-        {
-            return;
-        }
-    }
-
-    vec2d proj_uwA0;
-    pA.find_closest_uw( ip0, plane_uwA0.v, proj_uwA0.v );
-
-    vec2d proj_uwB0;
-    pB.find_closest_uw( ip0, plane_uwB0.v, proj_uwB0.v );
-
-    vec2d proj_uwA1;
-    pA.find_closest_uw( ip1, plane_uwA1.v, proj_uwA1.v );
-
-    vec2d proj_uwB1;
-    pB.find_closest_uw( ip1, plane_uwB1.v, proj_uwB1.v );
-
-    Puw* puwA0 = new Puw( pA.get_surf_ptr(), proj_uwA0 );
+    Puw* puwA0 = new Puw( iseg.m_SurfA, iseg.m_UWA[0] );
     m_DelPuwVec.push_back( puwA0 );
 
-    Puw* puwB0 = new Puw( pB.get_surf_ptr(), proj_uwB0 );
+    Puw* puwB0 = new Puw( iseg.m_SurfB, iseg.m_UWB[0] );
     m_DelPuwVec.push_back( puwB0 );
 
     IPnt* ipnt0 = new IPnt( puwA0, puwB0 );
-    ipnt0->m_Pnt = ip0;
+    ipnt0->m_Pnt = iseg.m_Pnt[0];
     m_DelIPntVec.push_back( ipnt0 );
 
-    Puw* puwA1 = new Puw( pA.get_surf_ptr(), proj_uwA1 );
+    Puw* puwA1 = new Puw( iseg.m_SurfA, iseg.m_UWA[1] );
     m_DelPuwVec.push_back( puwA1 );
 
-    Puw* puwB1 = new Puw( pB.get_surf_ptr(), proj_uwB1 );
+    Puw* puwB1 = new Puw( iseg.m_SurfB, iseg.m_UWB[1] );
     m_DelPuwVec.push_back( puwB1 );
 
     IPnt* ipnt1 = new IPnt( puwA1, puwB1 );
-    ipnt1->m_Pnt = ip1;
+    ipnt1->m_Pnt = iseg.m_Pnt[1];
     m_DelIPntVec.push_back( ipnt1 );
 
     // Identify rectangles to represent final patches
-    m_IPatchADrawLines.push_back( pA.GetPatchDrawLines() );
-    m_IPatchBDrawLines.push_back( pB.GetPatchDrawLines() );
+    m_IPatchADrawLines.push_back( iseg.m_PatchADrawLines );
+    m_IPatchBDrawLines.push_back( iseg.m_PatchBDrawLines );
 
-    new ISeg( pA.get_surf_ptr(), pB.get_surf_ptr(), ipnt0, ipnt1 );
+    new ISeg( iseg.m_SurfA, iseg.m_SurfB, ipnt0, ipnt1 );
 
     m_AllIPnts.push_back( ipnt0 );
     m_AllIPnts.push_back( ipnt1 );
@@ -1878,6 +1915,9 @@ void SurfaceIntersectionSingleton::AddIntersectionSeg( const SurfPatch& pA, cons
         onetime = false;
     }
 
+    const vec3d & ip0 = iseg.m_Pnt[0];
+    const vec3d & ip1 = iseg.m_Pnt[1];
+
     double dA0 = dist( ip0, puwA0->m_Surf->CompPnt( puwA0->m_UW.x(), puwA0->m_UW.y() ) );
     double dB0 = dist( ip0, puwB0->m_Surf->CompPnt( puwB0->m_UW.x(), puwB0->m_UW.y() ) );
 
@@ -21,7 +21,7 @@
 //              Match SCurves to create ICurves.  Create wakes surfs.
 //
 //  Intersect: Intersect all surfaces.  Intersect Y Slice Plane.
-//      Surf::Intersect - subdivide in to patches, keep splitting till planer, intersect.
+//      Surf::IntersectPatch - for patch pairs from the BVH broad phase, keep splitting till planer, intersect.
 //          CfdMeshMgr::AddIntersectionSeg - Create intersection points and segments.
 //
 //      CfdMeshMgr::LoadBorderCurves: Tesselate border curves, build border chains.
@@ -59,6 +59,7 @@
 #endif
 
 #include "Surf.h"
+#include "IntersectPatch.h"
 #include "Mesh.h"
 #include "SCurve.h"
 #include "ICurve.h"
@@ -91,6 +92,25 @@ using namespace std;
 
 class WakeMgrSingleton;
 
+//==== One Patch Of Surface A To Intersect Against Surface B ====//
+class SurfPatchTask
+{
+public:
+
+    SurfPatchTask( int surf_a, int surf_b, int patch )
+    {
+        m_SurfA = surf_a;
+        m_SurfB = surf_b;
+        m_Patch = patch;
+    }
+
+    int m_SurfA;
+    int m_SurfB;
+    int m_Patch;
+
+    vector < int > m_OtherPatchVec;     // Patches of m_SurfB whose boxes overlap m_Patch
+};
+
 class Wake
 {
 public:
@@ -225,6 +245,7 @@ public:
     virtual int GetSimpSubSurfIndex( string ss_id );
 
     void addOutputText( string str, int output_type = VOCAL_OUTPUT );
+    void FlushOutputText();
 
     virtual void UpdateDrawObjs();
     virtual void LoadDrawObjs( vector< DrawObj* > & draw_obj_vec );
@@ -260,7 +281,7 @@ public:
     virtual void Intersect();
 
 //  virtual void AddISeg( Surf* sA, Surf* sB, vec2d & sAuw0, vec2d & sAuw1,  vec2d & sBuw0, vec2d & sBuw1 );
-    virtual void AddIntersectionSeg( const SurfPatch& pA, const SurfPatch& pB, const vec3d & ip0, const vec3d & ip1 );
+    virtual void AddIntersectionSeg( const PatchISeg & iseg );
 //  virtual ISeg* CreateSurfaceSeg( Surf* sPtr, vec3d & p0, vec3d & p1, vec2d & uw0, vec2d & uw1 );
     virtual ISeg* CreateSurfaceSeg( Surf* surfA, vec2d & uwA0, vec2d & uwA1, Surf* surfB, vec2d & uwB0, vec2d & uwB1  );
 
@@ -415,6 +436,10 @@ protected:
 
     string m_MessageName; // Either "SurfIntersectMessage", "CFDMessage", or "FEAMessage"
 
+    // Hold output text until FlushOutputText() so concurrent runs don't interleave
+    bool m_BufferOutputFlag;
+    vector < string > m_OutputBuffer;
+
     // m_SurfVec translated to a vector of NURBS surfaces
     vector < NURBS_Surface > m_NURBSSurfVec;
 
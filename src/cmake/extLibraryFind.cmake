@@ -50,6 +50,9 @@ FIND_PACKAGE(STEPCODE REQUIRED)
 SET( CMAKE_PREFIX_PATH ${TRIANGLE_INSTALL_DIR} ${ORIG_CMAKE_PREFIX_PATH} )
 FIND_PACKAGE(TRIANGLE REQUIRED)
 
+# Optional.  Meshing and geometry loops run serially when OpenMP is not available.
+FIND_PACKAGE(OpenMP)
+
 IF( NOT VSP_NO_GRAPHICS )
     IF( NOT NOREGEXP )
         SET( CMAKE_PREFIX_PATH ${EXPRPARSE_INSTALL_DIR} ${ORIG_CMAKE_PREFIX_PATH} )
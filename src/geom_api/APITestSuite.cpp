@@ -7,6 +7,7 @@
 
 #include "VSP_Geom_API.h"
 #include "APITestSuite.h"
+#include "LinkMgr.h"
 #include <float.h>
 
 //Default tolerance to use for tests.  Most calculations are done as doubles and choosing single precision FLT_MIN gives some allowance for precision stackup in calculations
@@ -262,7 +263,128 @@ void APITestSuite::CopyPasteGeometry()
 
 }
 
+void APITestSuite::TestGeomUpdateCache()
+{
+    printf( "APITestSuite::TestGeomUpdateCache()\n" );
+    // make sure setup works
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Add Fuselage Geom =====//
+    string fuse_id = vsp::AddGeom( "FUSELAGE" );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Reference Bounding Box Without Cache ====//
+    vsp::SetGeomUpdateCacheSize( 0 );
+    vsp::SetParmValUpdate( fuse_id, "Length", "Design", 20.0 );
+    vec3d ref_max = vsp::GetGeomBBoxMax( fuse_id, 0, false );
+    vec3d ref_min = vsp::GetGeomBBoxMin( fuse_id, 0, false );
+    TEST_ASSERT( vsp::GetGeomUpdateCacheHits() == 0 );
+
+    //==== Revisit Design Point With Cache Enabled ====//
+    vsp::SetGeomUpdateCacheSize( 4 );
+    vsp::SetParmValUpdate( fuse_id, "Length", "Design", 30.0 );
+    vsp::SetParmValUpdate( fuse_id, "Length", "Design", 20.0 );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    vsp::ResetGeomUpdateCacheStats();
+    vsp::SetParmValUpdate( fuse_id, "Length", "Design", 30.0 );
+    vsp::SetParmValUpdate( fuse_id, "Length", "Design", 20.0 );
+    TEST_ASSERT( vsp::GetGeomUpdateCacheHits() >= 2 );
+    TEST_ASSERT( vsp::GetGeomUpdateCacheMisses() == 0 );
+
+    //==== Cached Result Must Match Rebuilt Result ====//
+    vec3d max_pnt = vsp::GetGeomBBoxMax( fuse_id, 0, false );
+    vec3d min_pnt = vsp::GetGeomBBoxMin( fuse_id, 0, false );
+    TEST_ASSERT_DELTA( dist( max_pnt, ref_max ), 0.0, TEST_TOL );
+    TEST_ASSERT_DELTA( dist( min_pnt, ref_min ), 0.0, TEST_TOL );
+
+    vsp::SetGeomUpdateCacheSize( 0 );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Last Update Reports The Changed Geom And Its Stage Times ====//
+    vsp::SetParmVal( fuse_id, "Length", "Design", 25.0 );
+    vsp::Update();
+    TEST_ASSERT( vsp::GetLastUpdateNumGeoms() >= 1 );
+    TEST_ASSERT( vsp::GetLastUpdateClosureTime() >= 0.0 );
+    TEST_ASSERT( vsp::GetLastUpdateGeomTime() > 0.0 );
+    TEST_ASSERT( vsp::GetLastUpdateTessTime() >= 0.0 );
+    TEST_ASSERT( vsp::GetLastUpdateMgrTime() >= 0.0 );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+}
+
 // Test of analysis manager
+void APITestSuite::TestParmLinks()
+{
+    printf( "APITestSuite::TestParmLinks()\n" );
+
+    // make sure setup works
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    string a_id = vsp::AddUserParm( vsp::PARM_DOUBLE_TYPE, "LinkA", "LinkTest" );
+    string b_id = vsp::AddUserParm( vsp::PARM_DOUBLE_TYPE, "LinkB", "LinkTest" );
+    string c_id = vsp::AddUserParm( vsp::PARM_DOUBLE_TYPE, "LinkC", "LinkTest" );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    vsp::SetParmVal( a_id, 0.0 );
+    vsp::SetParmVal( b_id, 0.0 );
+    vsp::SetParmVal( c_id, 0.0 );
+
+    //==== Chain A -> B -> C, Added Downstream First ====//
+    TEST_ASSERT( LinkMgr.AddLink( b_id, c_id, false ) );
+    LinkMgr.GetLink( LinkMgr.GetNumLinks() - 1 )->m_Offset.Set( 10.0 );
+    TEST_ASSERT( LinkMgr.AddLink( a_id, b_id, false ) );
+    Link* ab_link = LinkMgr.GetLink( LinkMgr.GetNumLinks() - 1 );
+    ab_link->SetScaleFlag( true );
+    ab_link->m_Scale.Set( 2.0 );
+    ab_link->m_Offset.Set( 1.0 );
+
+    vsp::SetParmVal( a_id, 2.0 );
+    TEST_ASSERT_DELTA( vsp::GetParmVal( b_id ), 5.0, TEST_TOL );
+    TEST_ASSERT_DELTA( vsp::GetParmVal( c_id ), 15.0, TEST_TOL );
+
+    // Setting the middle of the chain only moves what is downstream
+    vsp::SetParmVal( b_id, 7.0 );
+    TEST_ASSERT_DELTA( vsp::GetParmVal( a_id ), 2.0, TEST_TOL );
+    TEST_ASSERT_DELTA( vsp::GetParmVal( c_id ), 17.0, TEST_TOL );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    //==== Close The Loop C -> A ====//
+    TEST_ASSERT( LinkMgr.AddLink( c_id, a_id, false ) );
+    LinkMgr.GetLink( LinkMgr.GetNumLinks() - 1 )->m_Offset.Set( 100.0 );
+
+    // Each parm is set once per change, so the loop stops at the parm that was set
+    vsp::SetParmVal( a_id, 3.0 );
+    TEST_ASSERT_DELTA( vsp::GetParmVal( a_id ), 3.0, TEST_TOL );
+    TEST_ASSERT_DELTA( vsp::GetParmVal( b_id ), 7.0, TEST_TOL );
+    TEST_ASSERT_DELTA( vsp::GetParmVal( c_id ), 17.0, TEST_TOL );
+
+    vsp::SetParmVal( c_id, 4.0 );
+    TEST_ASSERT_DELTA( vsp::GetParmVal( a_id ), 104.0, TEST_TOL );
+    TEST_ASSERT_DELTA( vsp::GetParmVal( b_id ), 209.0, TEST_TOL );
+    TEST_ASSERT_DELTA( vsp::GetParmVal( c_id ), 4.0, TEST_TOL );
+
+    // The loop is reported once when the link graph is rebuilt, not on every change
+    int num_loop_err = 0;
+    while ( vsp::ErrorMgr.GetNumTotalErrors() > 0 )
+    {
+        if ( vsp::ErrorMgr.PopLastError().GetErrorCode() == vsp::VSP_LINK_LOOP_DETECTED )
+        {
+            num_loop_err++;
+        }
+    }
+    TEST_ASSERT( num_loop_err == 1 );
+
+    LinkMgr.DelAllLinks();
+
+    // Final check for errors
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+    printf( "\n" );
+}
+
 void APITestSuite::CheckAnalysisMgr()
 {
     printf( "APITestSuite::CheckAnalysisMgr()\n" );
@@ -613,6 +735,112 @@ void APITestSuite::TestSaveLoad()
     printf( "\n" );
 }
 
+//==== Concatenate Every <tag>...</tag> Block Of A Saved File ====//
+static string ReadTagBlocks( const string & fname, const string & tag )
+{
+    string text, blocks;
+
+    FILE* fp = fopen( fname.c_str(), "r" );
+    if ( fp )
+    {
+        char buf[4096];
+        size_t n;
+        while ( ( n = fread( buf, 1, sizeof( buf ), fp ) ) > 0 )
+        {
+            text.append( buf, n );
+        }
+        fclose( fp );
+    }
+
+    string open_tag = "<" + tag + ">";
+    string close_tag = "</" + tag + ">";
+    size_t start = text.find( open_tag );
+    while ( start != string::npos )
+    {
+        size_t end = text.find( close_tag, start );
+        if ( end == string::npos )
+        {
+            break;
+        }
+        blocks += text.substr( start, end + close_tag.size() - start );
+        start = text.find( open_tag, end );
+    }
+    return blocks;
+}
+
+void APITestSuite::TestSaveLoadBinaryMesh()
+{
+    printf( "APITestSuite::TestSaveLoadBinaryMesh()\n" );
+
+    // make sure setup works
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Mesh Geom From CompGeom Of A Pod ====//
+    string pod_id = vsp::AddGeom( "POD" );
+    TEST_ASSERT( pod_id.c_str() != NULL );
+    vsp::Update();
+    vsp::ComputeCompGeom( vsp::SET_ALL, false, 0 );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    //==== Point Cloud Geom With Awkward Values ====//
+    string pts_fname = "apitest_BinaryMesh.pts";
+    FILE* fp = fopen( pts_fname.c_str(), "w" );
+    TEST_ASSERT( fp != NULL );
+    if ( fp )
+    {
+        for ( int i = 0; i < 100; i++ )
+        {
+            fprintf( fp, "%.17g %.17g %.17g\n", i / 3.0, -1.0e-7 * i, sin( 0.1 * i ) * 1.0e5 );
+        }
+        fclose( fp );
+    }
+    string pts_id = vsp::ImportFile( pts_fname, vsp::IMPORT_PTS, "" );
+    TEST_ASSERT( pts_id.size() > 0 );
+    vsp::Update();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    //==== Text Reference, Then Binary ====//
+    string veh_id = vsp::FindContainer( "Vehicle", 0 );
+    string text_fname = "apitest_BinaryMesh_text.vsp3";
+    string bin_fname = "apitest_BinaryMesh_bin.vsp3";
+    string reload_fname = "apitest_BinaryMesh_reload.vsp3";
+
+    vsp::SetParmVal( veh_id, "BinaryMeshFlag", "VSP3Settings", 0.0 );
+    vsp::WriteVSPFile( text_fname );
+    vsp::SetParmVal( veh_id, "BinaryMeshFlag", "VSP3Settings", 1.0 );
+    vsp::WriteVSPFile( bin_fname );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    TEST_ASSERT( ReadTagBlocks( bin_fname, "Tri_Data" ).size() > 0 );
+    TEST_ASSERT( ReadTagBlocks( bin_fname, "Pt_Data" ).size() > 0 );
+    TEST_ASSERT( ReadTagBlocks( bin_fname, "Tri_List" ).size() == 0 );
+    TEST_ASSERT( ReadTagBlocks( bin_fname, "Pt_List" ).size() == 0 );
+
+    //==== Reload The Binary File And Write It Back Out As Text ====//
+    vsp::VSPRenew();
+    vsp::ReadVSPFile( bin_fname );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    veh_id = vsp::FindContainer( "Vehicle", 0 );
+    vsp::SetParmVal( veh_id, "BinaryMeshFlag", "VSP3Settings", 0.0 );
+    vsp::WriteVSPFile( reload_fname );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    // Every tri vertex, tri normal and point must survive the binary trip exactly
+    string text_tris = ReadTagBlocks( text_fname, "TMesh" );
+    string text_pts = ReadTagBlocks( text_fname, "Pt_List" );
+    TEST_ASSERT( text_tris.size() > 0 );
+    TEST_ASSERT( text_pts.size() > 0 );
+    TEST_ASSERT( ReadTagBlocks( reload_fname, "TMesh" ) == text_tris );
+    TEST_ASSERT( ReadTagBlocks( reload_fname, "Pt_List" ) == text_pts );
+
+    // Final check for errors
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+    printf( "\n" );
+}
+
 void APITestSuite::TestFEAMesh()
 {
     printf( "APITestSuite::TestFEAMesh()\n" );
@@ -26,6 +26,8 @@ public:
         TEST_ADD( APITestSuite::CopyPasteSetTest )
         TEST_ADD( APITestSuite::ChangePodParams )
         TEST_ADD( APITestSuite::CopyPasteGeometry )
+        TEST_ADD( APITestSuite::TestGeomUpdateCache )
+        TEST_ADD( APITestSuite::TestParmLinks )
         // Analysis
         TEST_ADD( APITestSuite::CheckAnalysisMgr )
         TEST_ADD( APITestSuite::TestAnalysesWithPod )
@@ -36,6 +38,7 @@ public:
         TEST_ADD( APITestSuite::TestFacetExport )
         // Save and Load
         TEST_ADD( APITestSuite::TestSaveLoad )
+        TEST_ADD( APITestSuite::TestSaveLoadBinaryMesh )
         // FEA Mesh
         TEST_ADD( APITestSuite::TestFEAMesh )
         // XSec
@@ -50,6 +53,8 @@ private:
     void CopyPasteSetTest();
     void ChangePodParams();
     void CopyPasteGeometry();
+    void TestGeomUpdateCache();
+    void TestParmLinks();
     // Analysis
     void CheckAnalysisMgr();
     void TestAnalysesWithPod();
@@ -59,6 +64,7 @@ private:
     void TestFacetExport();
     // Save and Load
     void TestSaveLoad();
+    void TestSaveLoadBinaryMesh();
     // FEA Mesh
     void TestFEAMesh();
     // XSec
@@ -10,8 +10,11 @@
 #include "VSP_Geom_API.h"
 #include "APITestSuiteCFDMesh.h"
 #include "APIDefines.h"
+#include "FeaMeshMgr.h"
+#include "StructureMgr.h"
 
 #include<fstream>
+#include <sstream>
 
 #include <chrono>
 using namespace std::chrono;
@@ -441,4 +444,289 @@ void APITestSuiteCFDMesh::FEAMeshAnalysisTest()
     TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
     printf( "COMPLETE\n" );
 
-}
\ No newline at end of file
+}
+
+//==== Read Whole File Into String ====//
+static string ReadFileToString( const string & file_name )
+{
+    string contents;
+    FILE* fp = fopen( file_name.c_str(), "rb" );
+    if ( fp )
+    {
+        char buf[4096];
+        size_t n;
+        while ( ( n = fread( buf, 1, sizeof( buf ), fp ) ) > 0 )
+        {
+            contents.append( buf, n );
+        }
+        fclose( fp );
+    }
+    return contents;
+}
+
+void APITestSuiteCFDMesh::FEAExportBenchmarkTest()
+{
+    printf( "APITestSuiteCFDMesh::FEAExportBenchmarkTest()\n" );
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+
+    //==== Reference Structure ====//
+    printf( "\tGenerating geometry\n" );
+    string pod_id = vsp::AddGeom( "POD" );
+
+    double length = 15.0;
+
+    vsp::SetParmValUpdate( pod_id, "X_Rel_Location", "XForm", 5.0 );
+    vsp::SetParmValUpdate( pod_id, "X_Rel_Rotation", "XForm", 90 );
+    vsp::SetParmValUpdate( pod_id, "Length", "Design", length );
+
+    vsp::Update();
+
+    int struct_ind = vsp::AddFeaStruct( pod_id );
+    TEST_ASSERT( struct_ind != -1 );
+
+    vsp::SetFeaMeshVal( pod_id, struct_ind, vsp::CFD_MAX_EDGE_LEN, 0.1 );
+    vsp::SetFeaMeshVal( pod_id, struct_ind, vsp::CFD_MIN_EDGE_LEN, 0.02 );
+
+    string floor_id = vsp::AddFeaPart( pod_id, struct_ind, vsp::FEA_SLICE );
+    vsp::SetParmVal( vsp::FindParm( floor_id, "IncludedElements", "FeaPart" ), vsp::FEA_PART_ELEMENT_TYPE::FEA_SHELL_AND_BEAM );
+    vsp::SetParmVal( vsp::FindParm( floor_id, "RelCenterLocation", "FeaPart" ), 0.34 );
+    vsp::SetParmVal( vsp::FindParm( floor_id, "OrientationPlane", "FeaSlice" ), vsp::FEA_SLICE_TYPE::XZ_BODY );
+
+    string bulkhead_id = vsp::AddFeaPart( pod_id, struct_ind, vsp::FEA_SLICE );
+    vsp::SetParmVal( vsp::FindParm( bulkhead_id, "IncludedElements", "FeaPart" ), vsp::FEA_PART_ELEMENT_TYPE::FEA_SHELL_AND_BEAM );
+    vsp::SetParmVal( vsp::FindParm( bulkhead_id, "RelCenterLocation", "FeaPart" ), 0.15 );
+    vsp::SetParmVal( vsp::FindParm( bulkhead_id, "OrientationPlane", "FeaSlice" ), vsp::FEA_SLICE_TYPE::SPINE_NORMAL );
+
+    string dome_id = vsp::AddFeaPart( pod_id, struct_ind, vsp::FEA_DOME );
+    vsp::SetParmVal( vsp::FindParm( dome_id, "IncludedElements", "FeaPart" ), vsp::FEA_PART_ELEMENT_TYPE::FEA_SHELL );
+    vsp::SetParmVal( vsp::FindParm( dome_id, "X_Location", "FeaDome" ), 0.7 * length );
+    vsp::SetParmVal( vsp::FindParm( dome_id, "A_Radius", "FeaDome" ), 1.5 );
+
+    vsp::Update();
+
+    printf( "\tGenerating FEA Mesh\n" );
+    vsp::SetFeaMeshFileName( pod_id, struct_ind, vsp::FEA_NASTRAN_FILE_NAME, "apitest_FEAExportBenchmark.dat" );
+    vsp::ComputeFeaMesh( pod_id, struct_ind, vsp::FEA_NASTRAN_FILE_NAME );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    FeaMesh* mesh = FeaMeshMgr.GetMeshPtr( vsp::GetFeaStructID( pod_id, struct_ind ) );
+    TEST_ASSERT( mesh != NULL );
+    if ( !mesh )
+    {
+        return;
+    }
+
+    vector < FeaNode* > node_vec;
+    for ( size_t i = 0; i < mesh->m_FeaNodeVec.size(); i++ )
+    {
+        if ( mesh->m_FeaNodeVecUsed[i] )
+        {
+            node_vec.push_back( mesh->m_FeaNodeVec[i] );
+        }
+    }
+    vector < FeaElement* > & elem_vec = mesh->m_FeaElementVec;
+
+    printf( "\tNodes: %d Elements: %d\n", ( int )node_vec.size(), ( int )elem_vec.size() );
+    TEST_ASSERT( node_vec.size() > 0 && elem_vec.size() > 0 );
+
+    // Repeat the node and element blocks to get a measurable file size
+    int npass = 20;
+
+    string ftype[2] = { "nastran", "calculix" };
+
+    for ( int itype = 0; itype < 2; itype++ )
+    {
+        bool nastran = ( itype == 0 );
+
+        //==== Current Writers: One fprintf Per Record ====//
+        string legacy_name = "apitest_FEAExportBenchmark_" + ftype[itype] + "_fprintf.txt";
+        FILE* fp = fopen( legacy_name.c_str(), "w" );
+        TEST_ASSERT( fp != NULL );
+        if ( !fp )
+        {
+            return;
+        }
+
+        auto start = high_resolution_clock::now();
+        for ( int ipass = 0; ipass < npass; ipass++ )
+        {
+            for ( size_t i = 0; i < node_vec.size(); i++ )
+            {
+                if ( nastran )
+                {
+                    node_vec[i]->WriteNASTRAN( fp, 0 );
+                }
+                else
+                {
+                    node_vec[i]->WriteCalculix( fp, 0 );
+                }
+            }
+            for ( size_t i = 0; i < elem_vec.size(); i++ )
+            {
+                if ( nastran )
+                {
+                    elem_vec[i]->WriteNASTRAN( fp, ( int )i + 1, 0, 0, 0 );
+                }
+                else
+                {
+                    elem_vec[i]->WriteCalculix( fp, ( int )i + 1, 0, 0 );
+                }
+            }
+        }
+        fclose( fp );
+        auto stop = high_resolution_clock::now();
+        double legacy_time = duration_cast < microseconds > ( stop - start ).count() * 1.0e-6;
+
+        //==== Buffered Writers: Chunks Formatted In Parallel ====//
+        string buffered_name = "apitest_FEAExportBenchmark_" + ftype[itype] + "_buffered.txt";
+        fp = fopen( buffered_name.c_str(), "w" );
+        TEST_ASSERT( fp != NULL );
+        if ( !fp )
+        {
+            return;
+        }
+
+        start = high_resolution_clock::now();
+        for ( int ipass = 0; ipass < npass; ipass++ )
+        {
+            WriteRecords( fp, node_vec.size(), [&]( FormatBuffer & buf, size_t i )
+            {
+                if ( nastran )
+                {
+                    node_vec[i]->WriteNASTRAN( buf, 0 );
+                }
+                else
+                {
+                    node_vec[i]->WriteCalculix( buf, 0 );
+                }
+            } );
+            WriteRecords( fp, elem_vec.size(), [&]( FormatBuffer & buf, size_t i )
+            {
+                if ( nastran )
+                {
+                    elem_vec[i]->WriteNASTRAN( buf, ( int )i + 1, 0, 0, 0 );
+                }
+                else
+                {
+                    elem_vec[i]->WriteCalculix( buf, ( int )i + 1, 0, 0 );
+                }
+            } );
+        }
+        fclose( fp );
+        stop = high_resolution_clock::now();
+        double buffered_time = duration_cast < microseconds > ( stop - start ).count() * 1.0e-6;
+
+        string legacy_str = ReadFileToString( legacy_name );
+        string buffered_str = ReadFileToString( buffered_name );
+
+        printf( "\t%s: %.1f MB fprintf %.3f s buffered %.3f s speedup %.1fx\n", ftype[itype].c_str(),
+                legacy_str.size() * 1.0e-6, legacy_time, buffered_time, buffered_time > 0 ? legacy_time / buffered_time : 0.0 );
+
+        // Output must be byte for byte identical
+        TEST_ASSERT( legacy_str.size() > 0 );
+        TEST_ASSERT( legacy_str == buffered_str );
+    }
+
+    printf( "COMPLETE\n" );
+}
+
+string APITestSuiteCFDMesh::ReadFile( const string & file_name )
+{
+    ifstream file( file_name.c_str(), ios::binary );
+    stringstream ss;
+    ss << file.rdbuf();
+    return ss.str();
+}
+
+void APITestSuiteCFDMesh::FEAIncrementalRemeshTest()
+{
+    printf( "APITestSuiteCFDMesh::FEAIncrementalRemeshTest()\n" );
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+
+    //==== Reference Structure ====//
+    printf( "\tGenerating geometry\n" );
+    string pod_id = vsp::AddGeom( "POD" );
+
+    vsp::SetParmValUpdate( pod_id, "Length", "Design", 15.0 );
+
+    vsp::Update();
+
+    int struct_ind = vsp::AddFeaStruct( pod_id );
+    TEST_ASSERT( struct_ind != -1 );
+
+    string struct_id = vsp::GetFeaStructID( pod_id, struct_ind );
+    FeaStructure* fea_struct = StructureMgr.GetFeaStruct( struct_id );
+    TEST_ASSERT( fea_struct != NULL );
+    if ( !fea_struct )
+    {
+        return;
+    }
+    fea_struct->GetStructSettingsPtr()->m_IncrementalRemeshFlag.Set( true );
+
+    vsp::SetFeaMeshVal( pod_id, struct_ind, vsp::CFD_MAX_EDGE_LEN, 0.5 );
+    vsp::SetFeaMeshVal( pod_id, struct_ind, vsp::CFD_MIN_EDGE_LEN, 0.1 );
+
+    string floor_id = vsp::AddFeaPart( pod_id, struct_ind, vsp::FEA_SLICE );
+    vsp::SetParmVal( vsp::FindParm( floor_id, "IncludedElements", "FeaPart" ), vsp::FEA_PART_ELEMENT_TYPE::FEA_SHELL_AND_BEAM );
+    vsp::SetParmVal( vsp::FindParm( floor_id, "RelCenterLocation", "FeaPart" ), 0.34 );
+    vsp::SetParmVal( vsp::FindParm( floor_id, "OrientationPlane", "FeaSlice" ), vsp::FEA_SLICE_TYPE::XZ_BODY );
+
+    string bulkhead_id = vsp::AddFeaPart( pod_id, struct_ind, vsp::FEA_SLICE );
+    vsp::SetParmVal( vsp::FindParm( bulkhead_id, "IncludedElements", "FeaPart" ), vsp::FEA_PART_ELEMENT_TYPE::FEA_SHELL );
+    vsp::SetParmVal( vsp::FindParm( bulkhead_id, "RelCenterLocation", "FeaPart" ), 0.5 );
+    vsp::SetParmVal( vsp::FindParm( bulkhead_id, "OrientationPlane", "FeaSlice" ), vsp::FEA_SLICE_TYPE::SPINE_NORMAL );
+
+    vsp::Update();
+
+    //==== First Run Remeshes Every Surface ====//
+    printf( "\tGenerating FEA Mesh\n" );
+    string fresh_name = "apitest_FEAIncrementalRemesh_fresh.dat";
+    vsp::SetFeaMeshFileName( pod_id, struct_ind, vsp::FEA_NASTRAN_FILE_NAME, fresh_name );
+    vsp::ComputeFeaMesh( pod_id, struct_ind, vsp::FEA_NASTRAN_FILE_NAME );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    FeaMesh* mesh = FeaMeshMgr.GetMeshPtr( struct_id );
+    TEST_ASSERT( mesh != NULL );
+    if ( !mesh )
+    {
+        return;
+    }
+    TEST_ASSERT( mesh->m_RemeshCache.GetNumReused() == 0 );
+
+    //==== Second Run Of The Same Structure Restores Every Surface ====//
+    printf( "\tRegenerating FEA Mesh\n" );
+    string cached_name = "apitest_FEAIncrementalRemesh_cached.dat";
+    vsp::SetFeaMeshFileName( pod_id, struct_ind, vsp::FEA_NASTRAN_FILE_NAME, cached_name );
+    vsp::ComputeFeaMesh( pod_id, struct_ind, vsp::FEA_NASTRAN_FILE_NAME );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    mesh = FeaMeshMgr.GetMeshPtr( struct_id );
+    TEST_ASSERT( mesh != NULL );
+    if ( !mesh )
+    {
+        return;
+    }
+    int num_reused = mesh->m_RemeshCache.GetNumReused();
+    printf( "\tReused %d surface meshes\n", num_reused );
+    TEST_ASSERT( num_reused > 0 );
+
+    string fresh_str = ReadFile( fresh_name );
+    TEST_ASSERT( !fresh_str.empty() );
+    TEST_ASSERT( fresh_str == ReadFile( cached_name ) );
+
+    //==== Changing The Target Length Invalidates The Cached Surfaces ====//
+    vsp::SetFeaMeshVal( pod_id, struct_ind, vsp::CFD_MAX_EDGE_LEN, 0.4 );
+    vsp::ComputeFeaMesh( pod_id, struct_ind, vsp::FEA_NASTRAN_FILE_NAME );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    mesh = FeaMeshMgr.GetMeshPtr( struct_id );
+    TEST_ASSERT( mesh != NULL );
+    if ( mesh )
+    {
+        TEST_ASSERT( mesh->m_RemeshCache.GetNumReused() < num_reused );
+    }
+
+    printf( "\n" );
+}
@@ -23,6 +23,8 @@ public:
         TEST_ADD( APITestSuiteCFDMesh::TestSurfaceIntersection )
         TEST_ADD( APITestSuiteCFDMesh::CFDMeshAnalysisTest)
         TEST_ADD( APITestSuiteCFDMesh::FEAMeshAnalysisTest)
+        TEST_ADD( APITestSuiteCFDMesh::FEAExportBenchmarkTest )
+        TEST_ADD( APITestSuiteCFDMesh::FEAIncrementalRemeshTest )
     }
 
 private:
@@ -34,6 +36,9 @@ private:
     void RunScaleTest( double scale_value, double test_compare_percent );
     void CFDMeshAnalysisTest();
     void FEAMeshAnalysisTest();
+    void FEAExportBenchmarkTest();
+    void FEAIncrementalRemeshTest();
+    string ReadFile( const string & file_name );
 };
 
 #endif // !defined(VSPAPITESTSUITECFDMESH__INCLUDED_)
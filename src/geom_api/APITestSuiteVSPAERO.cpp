@@ -564,6 +564,83 @@ void APITestSuiteVSPAERO::TestVSPAeroSinglePoint()
     printf( "\n" );
 }
 
+void APITestSuiteVSPAERO::TestVSPAeroSinglePointLibrary()
+{
+    printf( "APITestSuiteVSPAERO::TestVSPAeroSinglePointLibrary()\n" );
+
+    // make sure setup works
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //open the file created in TestVSPAeroCreateModel
+    vsp::ReadVSPFile( m_vspfname_for_vspaerotests );
+    if ( m_vspfname_for_vspaerotests == string() )
+    {
+        TEST_FAIL( "m_vspfname_for_vspaerotests = NULL, need to run: APITestSuite::TestVSPAeroComputeGeom" );
+        return;
+    }
+    if ( vsp::ErrorMgr.PopErrorAndPrint( stdout ) )
+    {
+        TEST_FAIL( "m_vspfname_for_vspaerotests failed to open" );
+        return;
+    }
+
+    //==== Analysis: VSPAERO Single Point, in process and through the executable ====//
+    string analysis_name = "VSPAEROSweep";
+    printf( "\t%s\n", analysis_name.c_str() );
+    vsp::SetAnalysisInputDefaults( analysis_name );
+
+    std::vector< int > analysis_method; analysis_method.push_back( vsp::VSPAERO_ANALYSIS_METHOD::VORTEX_LATTICE );
+    vsp::SetIntAnalysisInput( analysis_name, "AnalysisMethod", analysis_method, 0 );
+    std::vector< int > geom_set; geom_set.push_back( 0 );
+    vsp::SetIntAnalysisInput( analysis_name, "GeomSet", geom_set );
+    std::vector< double > alpha; alpha.push_back( 5 );
+    vsp::SetDoubleAnalysisInput( analysis_name, "AlphaStart", alpha );
+    vector< int > one_pt; one_pt.push_back( 1 );
+    vsp::SetIntAnalysisInput( analysis_name, "AlphaNpts", one_pt, 0 );
+    vsp::SetIntAnalysisInput( analysis_name, "BetaNpts", one_pt );
+    vsp::SetIntAnalysisInput( analysis_name, "MachNpts", one_pt );
+    vsp::SetIntAnalysisInput( analysis_name, "ReCrefNpts", one_pt );
+
+    // A lone case must still close the history file before it is read back
+    vector < vector < double > > history( 2 );
+    const char* names[] = { "CL", "CDtot", "CMy" };
+
+    for ( int use_library = 0; use_library < 2; use_library++ )
+    {
+        vector< int > library_flag; library_flag.push_back( use_library );
+        vsp::SetIntAnalysisInput( analysis_name, "SolverLibraryFlag", library_flag );
+
+        printf( "\n\t\tExecuting..." );
+        string results_id = vsp::ExecAnalysis( analysis_name );
+        TEST_ASSERT( results_id.size() > 0 );
+        printf( "COMPLETE\n\n" );
+        TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+        string history_id = vsp::FindLatestResultsID( "VSPAERO_History" );
+        TEST_ASSERT( history_id.size() > 0 );
+
+        for ( int i = 0; i < 3; i++ )
+        {
+            vector < double > vals = vsp::GetDoubleResults( history_id, names[i] );
+            TEST_ASSERT( vals.size() > 0 );
+            history[use_library].push_back( vals.size() > 0 ? vals.back() : 0.0 );
+        }
+    }
+
+    // Wake iterations converge to the same answer within the Krylov tolerance
+    for ( int i = 0; i < 3; i++ )
+    {
+        printf( "\t%s executable %12.8f library %12.8f\n", names[i], history[0][i], history[1][i] );
+        TEST_ASSERT_DELTA( history[1][i], history[0][i], 1e-6 * std::max( 1.0, std::abs( history[0][i] ) ) );
+    }
+
+    // Final check for errors
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+    printf( "\n" );
+}
+
 void APITestSuiteVSPAERO::TestVSPAeroSinglePointStab()
 {
     printf( "APITestSuiteVSPAERO::TestVSPAeroSinglePointStab()\n" );
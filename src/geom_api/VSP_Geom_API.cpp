@@ -165,6 +165,69 @@ void Update( bool update_managers )
 }
 
 
+void SetGeomUpdateCacheSize( int size )
+{
+    Vehicle* veh = GetVehicle();
+    veh->SetUpdateCacheSize( size );
+    ErrorMgr.NoError();
+}
+
+int GetGeomUpdateCacheHits()
+{
+    Vehicle* veh = GetVehicle();
+    ErrorMgr.NoError();
+    return veh->GetUpdateCacheHits();
+}
+
+int GetGeomUpdateCacheMisses()
+{
+    Vehicle* veh = GetVehicle();
+    ErrorMgr.NoError();
+    return veh->GetUpdateCacheMisses();
+}
+
+void ResetGeomUpdateCacheStats()
+{
+    Vehicle* veh = GetVehicle();
+    veh->ResetUpdateCacheStats();
+    ErrorMgr.NoError();
+}
+
+double GetLastUpdateClosureTime()
+{
+    Vehicle* veh = GetVehicle();
+    ErrorMgr.NoError();
+    return veh->GetLastUpdateClosureTime();
+}
+
+double GetLastUpdateGeomTime()
+{
+    Vehicle* veh = GetVehicle();
+    ErrorMgr.NoError();
+    return veh->GetLastUpdateGeomTime();
+}
+
+double GetLastUpdateTessTime()
+{
+    Vehicle* veh = GetVehicle();
+    ErrorMgr.NoError();
+    return veh->GetLastUpdateTessTime();
+}
+
+double GetLastUpdateMgrTime()
+{
+    Vehicle* veh = GetVehicle();
+    ErrorMgr.NoError();
+    return veh->GetLastUpdateMgrTime();
+}
+
+int GetLastUpdateNumGeoms()
+{
+    Vehicle* veh = GetVehicle();
+    ErrorMgr.NoError();
+    return veh->GetLastUpdateNumGeoms();
+}
+
 void VSPExit( int error_code )
 {
     exit( error_code );
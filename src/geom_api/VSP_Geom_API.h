@@ -349,6 +349,173 @@ extern void VSPExit( int error_code );
 
 extern int GetAndResetUpdateCount();
 
+/*!
+    \ingroup Vehicle
+*/
+/*!
+    Set the number of geometry update results each Geom keeps in its update cache. When a Geom returns to a parameter
+    state held in its cache, the skinned surface and main tessellation are reused instead of rebuilt. Useful when
+    optimization or DOE studies revisit design points. Changing the size clears all caches and statistics. The cache
+    is disabled (size zero) by default.
+    \forcpponly
+    \code{.cpp}
+    string pod_id = AddGeom( "POD" );
+
+    SetGeomUpdateCacheSize( 4 );
+
+    SetParmVal( pod_id, "FineRatio", "Design", 5.0 );
+    Update();
+    SetParmVal( pod_id, "FineRatio", "Design", 15.0 );
+    Update();
+    SetParmVal( pod_id, "FineRatio", "Design", 5.0 );   // Revisit
+    Update();
+
+    Print( "Cache hits: ", false );
+    Print( GetGeomUpdateCacheHits() );
+    \endcode
+    \endforcpponly
+    \beginPythonOnly
+    \code{.py}
+    pod_id = AddGeom( "POD" )
+
+    SetGeomUpdateCacheSize( 4 )
+
+    SetParmVal( pod_id, "FineRatio", "Design", 5.0 )
+    Update()
+    SetParmVal( pod_id, "FineRatio", "Design", 15.0 )
+    Update()
+    SetParmVal( pod_id, "FineRatio", "Design", 5.0 )   # Revisit
+    Update()
+
+    print( "Cache hits: ", False )
+    print( GetGeomUpdateCacheHits() )
+
+    \endcode
+    \endPythonOnly
+    \sa GetGeomUpdateCacheHits, GetGeomUpdateCacheMisses, ResetGeomUpdateCacheStats
+    \param [in] size Number of cached states per Geom, zero disables the cache
+*/
+
+extern void SetGeomUpdateCacheSize( int size );
+
+/*!
+    \ingroup Vehicle
+*/
+/*!
+    Get the number of Geom updates that reused results from the update cache since the statistics were last reset
+    \sa SetGeomUpdateCacheSize, GetGeomUpdateCacheMisses, ResetGeomUpdateCacheStats
+    \return Number of cache hits
+*/
+
+extern int GetGeomUpdateCacheHits();
+
+/*!
+    \ingroup Vehicle
+*/
+/*!
+    Get the number of Geom updates that were not found in the update cache since the statistics were last reset
+    \sa SetGeomUpdateCacheSize, GetGeomUpdateCacheHits, ResetGeomUpdateCacheStats
+    \return Number of cache misses
+*/
+
+extern int GetGeomUpdateCacheMisses();
+
+/*!
+    \ingroup Vehicle
+*/
+/*!
+    Reset the Geom update cache hit and miss counts to zero
+    \sa SetGeomUpdateCacheSize, GetGeomUpdateCacheHits, GetGeomUpdateCacheMisses
+*/
+
+extern void ResetGeomUpdateCacheStats();
+
+/*!
+    \ingroup Vehicle
+*/
+/*!
+    Get the time spent finding the Geoms that need to be updated during the last Vehicle update
+    \sa GetLastUpdateGeomTime, GetLastUpdateTessTime, GetLastUpdateMgrTime, GetLastUpdateNumGeoms
+    \return Elapsed time (sec)
+*/
+
+extern double GetLastUpdateClosureTime();
+
+/*!
+    \ingroup Vehicle
+*/
+/*!
+    Get the time spent updating Geom surfaces during the last Vehicle update
+    \forcpponly
+    \code{.cpp}
+    string pod_id = AddGeom( "POD" );
+
+    SetParmVal( pod_id, "FineRatio", "Design", 5.0 );
+    Update();
+
+    Print( "Geoms updated: ", false );
+    Print( GetLastUpdateNumGeoms() );
+    Print( "Surface time: ", false );
+    Print( GetLastUpdateGeomTime() );
+    Print( "Tessellation time: ", false );
+    Print( GetLastUpdateTessTime() );
+    \endcode
+    \endforcpponly
+    \beginPythonOnly
+    \code{.py}
+    pod_id = AddGeom( "POD" )
+
+    SetParmVal( pod_id, "FineRatio", "Design", 5.0 )
+    Update()
+
+    print( "Geoms updated: ", False )
+    print( GetLastUpdateNumGeoms() )
+    print( "Surface time: ", False )
+    print( GetLastUpdateGeomTime() )
+    print( "Tessellation time: ", False )
+    print( GetLastUpdateTessTime() )
+
+    \endcode
+    \endPythonOnly
+    \sa GetLastUpdateClosureTime, GetLastUpdateTessTime, GetLastUpdateMgrTime, GetLastUpdateNumGeoms
+    \return Elapsed time (sec)
+*/
+
+extern double GetLastUpdateGeomTime();
+
+/*!
+    \ingroup Vehicle
+*/
+/*!
+    Get the time spent tessellating the updated Geoms during the last Vehicle update
+    \sa GetLastUpdateClosureTime, GetLastUpdateGeomTime, GetLastUpdateMgrTime, GetLastUpdateNumGeoms
+    \return Elapsed time (sec)
+*/
+
+extern double GetLastUpdateTessTime();
+
+/*!
+    \ingroup Vehicle
+*/
+/*!
+    Get the time spent updating the measure and background managers during the last Vehicle update
+    \sa GetLastUpdateClosureTime, GetLastUpdateGeomTime, GetLastUpdateTessTime, GetLastUpdateNumGeoms
+    \return Elapsed time (sec)
+*/
+
+extern double GetLastUpdateMgrTime();
+
+/*!
+    \ingroup Vehicle
+*/
+/*!
+    Get the number of Geoms updated by the last Vehicle update
+    \sa GetLastUpdateClosureTime, GetLastUpdateGeomTime, GetLastUpdateTessTime, GetLastUpdateMgrTime
+    \return Number of Geoms updated
+*/
+
+extern int GetLastUpdateNumGeoms();
+
 
 /*!
     \ingroup APIUtilities
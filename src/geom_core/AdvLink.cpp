@@ -8,6 +8,7 @@
 
 #include "AdvLink.h"
 #include "AdvLinkMgr.h"
+#include "LinkMgr.h"
 #include "ParmMgr.h"
 #include "ScriptMgr.h"
 #include "APIErrorMgr.h"
@@ -110,6 +111,7 @@ bool AdvLink::ValidateParms()
     {
         MessageMgr::getInstance().SendAll( errMsgData );
         m_ValidScript = false;
+        AdvLinkMgr.IncNumLinkChanges();
     }
 
     return all_valid_flag;
@@ -175,6 +177,7 @@ void AdvLink::AddVar( const VarDef & pd, bool input_flag )
     else
         m_OutputVars.push_back( pd );
 
+    AdvLinkMgr.IncNumLinkChanges();
 }
 
 void AdvLink::DeleteVar( int index, bool input_flag )
@@ -187,6 +190,8 @@ void AdvLink::DeleteVar( int index, bool input_flag )
     {
         m_OutputVars.erase( m_OutputVars.begin() + index );
     }
+
+    AdvLinkMgr.IncNumLinkChanges();
 }
 
 void AdvLink::DeleteAllVars( bool input_flag )
@@ -199,6 +204,8 @@ void AdvLink::DeleteAllVars( bool input_flag )
     {
         m_OutputVars.clear();
     }
+
+    AdvLinkMgr.IncNumLinkChanges();
 }
 
 void AdvLink::UpdateInputVarName( int index, const string & var_name, bool changeincode )
@@ -403,7 +410,7 @@ void AdvLink::SetVar( const string & var_name, double val )
         if ( m_OutputVars[i].m_VarName == var_name )
         {
             Parm* parm_ptr = ParmMgr.FindParm(  m_OutputVars[i].m_ParmID );
-            if ( parm_ptr && val > -1.0e15 && !parm_ptr->GetLinkUpdateFlag() )
+            if ( parm_ptr && val > -1.0e15 && !LinkMgr.ParmUpdatedByLinks( parm_ptr->GetID() ) )
             {
                 parm_ptr->SetFromLink( val );
                 break;
@@ -545,7 +552,7 @@ void AdvLink::ForceUpdate()
 
 vector< string > AdvLink::GetInputNames()
 {
-    vector< VarDef > in_vars = GetInputVars();
+    const vector< VarDef > & in_vars = GetInputVars();
     vector < string > in_names;
 
     for ( int i = 0; i < in_vars.size(); i++ )
@@ -558,7 +565,7 @@ vector< string > AdvLink::GetInputNames()
 
 vector< string > AdvLink::GetInputParms()
 {
-    vector< VarDef > in_vars = GetInputVars();
+    const vector< VarDef > & in_vars = GetInputVars();
     vector < string > in_parms;
 
     for ( int i = 0; i < in_vars.size(); i++ )
@@ -571,7 +578,7 @@ vector< string > AdvLink::GetInputParms()
 
 vector< string > AdvLink::GetOutputNames()
 {
-    vector< VarDef > out_vars = GetOutputVars();
+    const vector< VarDef > & out_vars = GetOutputVars();
     vector < string > out_names;
 
     for ( int i = 0; i < out_vars.size(); i++ )
@@ -584,7 +591,7 @@ vector< string > AdvLink::GetOutputNames()
 
 vector< string > AdvLink::GetOutputParms()
 {
-    vector< VarDef > out_vars = GetOutputVars();
+    const vector< VarDef > & out_vars = GetOutputVars();
     vector < string > out_parms;
 
     for ( int i = 0; i < out_vars.size(); i++ )
@@ -645,6 +652,8 @@ xmlNodePtr AdvLink::DecodeXml( xmlNodePtr & adv_link_node )
             xmlNodePtr var_def_node = XmlUtil::GetNode( output_node, "VarDef", i );
             m_OutputVars[i].DecodeXml( var_def_node );
         }
+
+        AdvLinkMgr.IncNumLinkChanges();
     }
 
     return adv_link_node;
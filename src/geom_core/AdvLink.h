@@ -88,8 +88,8 @@ public:
     bool UpdateLink( const string & pid );
     void ForceUpdate();
 
-    vector< VarDef > GetInputVars()                               { return m_InputVars; }
-    vector< VarDef > GetOutputVars()                              { return m_OutputVars; }
+    const vector< VarDef > & GetInputVars() const                { return m_InputVars; }
+    const vector< VarDef > & GetOutputVars() const               { return m_OutputVars; }
 
     vector< string > GetInputNames();
     vector< string > GetInputParms();
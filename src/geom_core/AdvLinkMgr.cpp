@@ -18,7 +18,8 @@ AdvLinkMgrSingleton::AdvLinkMgrSingleton()
 {
     m_ActiveLink = NULL;
     m_EditLinkIndex = 0;
-
+    m_NumLinkChanges = 0;
+    m_ParmMapStamp = -1;
 }
 
 void AdvLinkMgrSingleton::Init()
@@ -36,6 +37,7 @@ void AdvLinkMgrSingleton::Wype()
     m_LinkVec.clear();
     m_ActiveLink = NULL;
     m_EditLinkIndex = 0;
+    m_NumLinkChanges++;
 }
 
 void AdvLinkMgrSingleton::Renew()
@@ -77,6 +79,7 @@ AdvLink* AdvLinkMgrSingleton::AddLink( const string & name )
     alink->SetName( link_name );
     m_LinkVec.push_back( alink );
     m_EditLinkIndex = (int)m_LinkVec.size() - 1;
+    m_NumLinkChanges++;
 
     return alink;
 }
@@ -96,6 +99,7 @@ void AdvLinkMgrSingleton::DelLink( AdvLink* link_ptr )
 
     vector_remove_val( m_LinkVec, link_ptr );
     delete link_ptr;
+    m_NumLinkChanges++;
 }
 
 void AdvLinkMgrSingleton::DelLink( int index )
@@ -115,6 +119,7 @@ void AdvLinkMgrSingleton::DelAllLinks( )
         delete m_LinkVec[i];
     }
     m_LinkVec.clear();
+    m_NumLinkChanges++;
 }
 
 void AdvLinkMgrSingleton::CheckLinks()
@@ -210,42 +215,63 @@ double AdvLinkMgrSingleton::GetVar( const string & var_name )
     return m_ActiveLink->GetVar( var_name );
 }
 
-bool AdvLinkMgrSingleton::IsInputParm( const string& pid )
+//==== Index Links By Input And Output Parm ID ====//
+void AdvLinkMgrSingleton::BuildParmMaps()
 {
+    if ( m_ParmMapStamp == m_NumLinkChanges )
+    {
+        return;
+    }
+
+    m_ParmMapStamp = m_NumLinkChanges;
+
+    m_InputParmMap.clear();
+    m_OutputParmMap.clear();
+
     for ( int i = 0 ; i < (int)m_LinkVec.size() ; i++ )
     {
-         vector< VarDef > def_vec = m_LinkVec[i]->GetInputVars();
-         for ( int j = 0 ; j < (int)def_vec.size() ; j++ )
-         {
-             if ( pid == def_vec[j].m_ParmID )
-             {
-                 if ( ParmMgr.FindParm( pid ) )
-                 {
-                     return true;
-                 }
-             }
-         }
+        vector< string > in_vec = m_LinkVec[i]->GetInputParms();
+        for ( int j = 0 ; j < (int)in_vec.size() ; j++ )
+        {
+            vector< AdvLink* > & link_vec = m_InputParmMap[ in_vec[j] ];
+            if ( link_vec.empty() || link_vec.back() != m_LinkVec[i] )
+            {
+                link_vec.push_back( m_LinkVec[i] );
+            }
+        }
+
+        vector< string > out_vec = m_LinkVec[i]->GetOutputParms();
+        for ( int j = 0 ; j < (int)out_vec.size() ; j++ )
+        {
+            vector< AdvLink* > & link_vec = m_OutputParmMap[ out_vec[j] ];
+            if ( link_vec.empty() || link_vec.back() != m_LinkVec[i] )
+            {
+                link_vec.push_back( m_LinkVec[i] );
+            }
+        }
+    }
+}
+
+bool AdvLinkMgrSingleton::IsInputParm( const string& pid )
+{
+    BuildParmMaps();
+
+    if ( m_InputParmMap.find( pid ) == m_InputParmMap.end() )
+    {
+        return false;
     }
-    return false;
+    return ParmMgr.FindParm( pid ) != NULL;
 }
 
 bool AdvLinkMgrSingleton::IsOutputParm( const string& pid )
 {
-    for ( int i = 0 ; i < (int)m_LinkVec.size() ; i++ )
+    BuildParmMaps();
+
+    if ( m_OutputParmMap.find( pid ) == m_OutputParmMap.end() )
     {
-         vector< VarDef > def_vec = m_LinkVec[i]->GetOutputVars();
-         for ( int j = 0 ; j < (int)def_vec.size() ; j++ )
-         {
-             if ( pid == def_vec[j].m_ParmID )
-             {
-                 if ( ParmMgr.FindParm( pid ) )
-                 {
-                     return true;
-                 }
-             }
-         }
+        return false;
     }
-    return false;
+    return ParmMgr.FindParm( pid ) != NULL;
 }
 
 //==== Parm Changed ====//
@@ -258,10 +284,19 @@ void AdvLinkMgrSingleton::UpdateLinks( const string& pid  )
         return;
     }
 
-    //==== Check All Links And Update If Needed ====//
-    for ( int i = 0 ; i < (int)m_LinkVec.size() ; i++ )
+    BuildParmMaps();
+
+    unordered_map< string, vector< AdvLink* > >::iterator iter = m_InputParmMap.find( pid );
+    if ( iter == m_InputParmMap.end() )
+    {
+        return;
+    }
+
+    //==== Update Only The Links That Use This Parm ====//
+    vector< AdvLink* > link_vec = iter->second;        // Copy - Scripts May Edit Links
+    for ( int i = 0 ; i < (int)link_vec.size() ; i++ )
     {
-        m_LinkVec[i]->UpdateLink( pid );
+        link_vec[i]->UpdateLink( pid );
     }
 }
 
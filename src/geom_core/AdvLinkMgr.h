@@ -13,9 +13,11 @@
 
 #include "AdvLink.h"
 #include <deque>
+#include <unordered_map>
 using std::string;
 using std::vector;
 using std::deque;
+using std::unordered_map;
 
 
 //==== Adv Link Manager ====//
@@ -64,6 +66,9 @@ public:
     xmlNodePtr EncodeXml( xmlNodePtr & node );
     xmlNodePtr DecodeXml( xmlNodePtr & node );
 
+    //==== Bumped When Links Or Their Input/Output Vars Change ====//
+    int GetNumLinkChanges()                                             { return m_NumLinkChanges; }
+    void IncNumLinkChanges()                                            { m_NumLinkChanges++; }
 
 private:
 
@@ -72,10 +77,17 @@ private:
     AdvLinkMgrSingleton& operator=( AdvLinkMgrSingleton const& copy );  // Not Implemented
 
     void AddInputOutput( const string & parm_id, const string & var_name, bool input_flag );
+    void BuildParmMaps();
+
     int m_EditLinkIndex;
     AdvLink* m_ActiveLink;
     vector< AdvLink* > m_LinkVec;
 
+    int m_NumLinkChanges;
+    int m_ParmMapStamp;
+    unordered_map< string, vector< AdvLink* > > m_InputParmMap;     // Parm ID -> Links Using It As Input
+    unordered_map< string, vector< AdvLink* > > m_OutputParmMap;    // Parm ID -> Links Using It As Output
+
 };
 
 #define AdvLinkMgr AdvLinkMgrSingleton::getInstance()
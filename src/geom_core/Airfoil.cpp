@@ -1173,6 +1173,21 @@ void FileAirfoil::OffsetCurve( double offset_val )
 }
 
 //==== Read Airfoil File ====//
+//==== File Points Are Not Parms ====//
+void FileAirfoil::HashNonParmState( std::size_t & seed ) const
+{
+    for ( int i = 0 ; i < ( int )m_UpperPnts.size() ; i++ )
+    {
+        hash_combine( seed, m_UpperPnts[i].x() );
+        hash_combine( seed, m_UpperPnts[i].y() );
+    }
+    for ( int i = 0 ; i < ( int )m_LowerPnts.size() ; i++ )
+    {
+        hash_combine( seed, m_LowerPnts[i].x() );
+        hash_combine( seed, m_LowerPnts[i].y() );
+    }
+}
+
 bool FileAirfoil::ReadFile( string file_name )
 {
     //==== Open File ====//
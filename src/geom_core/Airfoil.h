@@ -385,6 +385,8 @@ public:
 
     virtual void ReadV2File( xmlNodePtr &root );
 
+    virtual void HashNonParmState( std::size_t & seed ) const;
+
     Parm m_BaseThickness;
 
 protected:
@@ -1111,6 +1111,8 @@ void ProjectionAnalysis::SetDefaults()
     m_Inputs.Add( NameValData( "DirectionGeomID", "", "Direction GeomID." ) );
 
     m_Inputs.Add( NameValData( "Direction", vec3d( 1.0, 0.0, 0.0 ), "Direction vector." ) );
+
+    m_Inputs.Add( NameValData( "DirectionVec", vector< vec3d >(), "Direction vectors, when not empty all are projected in parallel into one result." ) );
 }
 
 
@@ -1181,6 +1183,13 @@ string ProjectionAnalysis::Execute()
         dir = nvd->GetVec3d( 0 );
     }
 
+    vector< vec3d > dirvec;
+    nvd = m_Inputs.FindPtr( "DirectionVec", 0 );
+    if ( nvd )
+    {
+        dirvec = nvd->GetVec3dData();
+    }
+
     if ( directionType != vsp::VEC_PROJ)
     {
         dir = ProjectionMgr.GetDirection( directionType, directionGeomID );
@@ -1188,6 +1197,49 @@ string ProjectionAnalysis::Execute()
 
     Results* res = NULL;
 
+    if ( !dirvec.empty() )
+    {
+        switch ( boundaryType )
+        {
+            case vsp::NO_BOUNDARY:
+                if ( targetType == vsp::SET_TARGET )
+                {
+                    res = ProjectionMgr.ProjectMulti( targetSet, dirvec );
+                }
+                else
+                {
+                    res = ProjectionMgr.ProjectMulti( targetGeomID, dirvec );
+                }
+                break;
+            case vsp::SET_BOUNDARY:
+                if ( targetType == vsp::SET_TARGET )
+                {
+                    res = ProjectionMgr.ProjectMulti( targetSet, boundarySet, dirvec );
+                }
+                else
+                {
+                    res = ProjectionMgr.ProjectMulti( targetGeomID, boundarySet, dirvec );
+                }
+                break;
+            case vsp::GEOM_BOUNDARY:
+                if ( targetType == vsp::SET_TARGET )
+                {
+                    res = ProjectionMgr.ProjectMulti( targetSet, boundaryGeomID, dirvec );
+                }
+                else
+                {
+                    res = ProjectionMgr.ProjectMulti( targetGeomID, boundaryGeomID, dirvec );
+                }
+                break;
+        }
+
+        if ( !res )
+        {
+            return string();
+        }
+        return res->GetID();
+    }
+
     switch ( boundaryType )
     {
         case vsp::NO_BOUNDARY:
@@ -1520,6 +1572,7 @@ void VSPAEROSweepAnalysis::SetDefaults()
         m_Inputs.Add( NameValData( "Symmetry",                      VSPAEROMgr.m_Symmetry.Get()                       , "Symmetry mode enum." ) );
         m_Inputs.Add( NameValData( "2DFEMFlag",                     VSPAEROMgr.m_Write2DFEMFlag.Get()                 , "Flag to write 2D FEM file." ) );
         m_Inputs.Add( NameValData( "KTCorrection",                  VSPAEROMgr.m_KTCorrection.Get()                   , "Compressibility correction enum." ) );
+        m_Inputs.Add( NameValData( "SolverLibraryFlag",             VSPAEROMgr.m_SolverLibraryFlag.Get()              , "Flag to solve plain steady cases in process when the solver library is linked." ) );
         m_Inputs.Add( NameValData( "FromSteadyState",               VSPAEROMgr.m_FromSteadyState.Get()                , "Start unsteady solution from steady state." ) );
         m_Inputs.Add( NameValData( "GroundEffectToggle",            VSPAEROMgr.m_GroundEffectToggle.Get()             , "Flag to enable ground effect model." ) );
         m_Inputs.Add( NameValData( "GroundEffect",                  VSPAEROMgr.m_GroundEffect.Get()                   , "Height aboe ground." ) );
@@ -1777,6 +1830,7 @@ string VSPAEROSweepAnalysis::Execute()
         bool symmetryOrig            = VSPAEROMgr.m_Symmetry.Get();
         bool write2DFEMOrig          = VSPAEROMgr.m_Write2DFEMFlag.Get();
         bool ktCorrectionOrig        = VSPAEROMgr.m_KTCorrection.Get();
+        bool solverLibraryFlagOrig   = VSPAEROMgr.m_SolverLibraryFlag.Get();
         bool fromSteadyStateOrig     = VSPAEROMgr.m_FromSteadyState.Get();
         bool groundEffectToggleOrig  = VSPAEROMgr.m_GroundEffectToggle.Get();
         double groundEffectOrig      = VSPAEROMgr.m_GroundEffect.Get();
@@ -1836,6 +1890,11 @@ string VSPAEROSweepAnalysis::Execute()
         {
             VSPAEROMgr.m_KTCorrection.Set( nvd->GetInt( 0 ) );
         }
+        nvd = m_Inputs.FindPtr( "SolverLibraryFlag", 0 );
+        if ( nvd )
+        {
+            VSPAEROMgr.m_SolverLibraryFlag.Set( nvd->GetInt( 0 ) );
+        }
         nvd = m_Inputs.FindPtr( "FromSteadyState", 0 );
         if ( nvd )
         {
@@ -2068,6 +2127,7 @@ string VSPAEROSweepAnalysis::Execute()
         VSPAEROMgr.m_Symmetry.Set( symmetryOrig );
         VSPAEROMgr.m_Write2DFEMFlag.Set( write2DFEMOrig );
         VSPAEROMgr.m_KTCorrection.Set( ktCorrectionOrig );
+        VSPAEROMgr.m_SolverLibraryFlag.Set( solverLibraryFlagOrig );
         VSPAEROMgr.m_FromSteadyState.Set( fromSteadyStateOrig );
         VSPAEROMgr.m_GroundEffectToggle.Set( groundEffectToggleOrig );
         VSPAEROMgr.m_GroundEffect.Set( groundEffectOrig );
@@ -23,6 +23,8 @@ public:
     BORGeom( Vehicle* vehicle_ptr );
     virtual ~BORGeom();
 
+    virtual bool IsUpdateCacheable()                { return true; }
+
     virtual void ComputeCenter();
     virtual void Scale();
     virtual void AddDefaultSources( double base_len = 1.0 );
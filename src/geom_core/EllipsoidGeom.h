@@ -22,6 +22,8 @@ public:
     EllipsoidGeom( Vehicle* vehicle_ptr );
     virtual ~EllipsoidGeom();
 
+    virtual bool IsUpdateCacheable()                { return true; }
+
     virtual void ComputeCenter();
     virtual void Scale();
     virtual void AddDefaultSources( double base_len = 1.0 );
@@ -656,18 +656,32 @@ void FitModelMgrSingleton::BuildPtrVec()
     }
 }
 
+//==== Find Match Geoms Serially, Vehicle::FindGeom Is Not Thread Safe ====//
+void FitModelMgrSingleton::FindTargetGeoms( vector < Geom* > & geom_vec )
+{
+    int npt = m_TargetPts.size();
+
+    geom_vec.resize( npt );
+    for ( int i = 0 ; i < npt; i++ )
+    {
+        geom_vec[i] = VehicleMgr.GetVehicle()->FindGeom( m_TargetPts[i]->GetMatchGeom() );
+    }
+}
+
 void FitModelMgrSingleton::RefineTargetUW()
 {
     ValidateTargetPts();
 
+    vector < Geom* > geom_vec;
+    FindTargetGeoms( geom_vec );
+
     int npt = m_TargetPts.size();
 
+    // Each point starts from its current (u,w) and only reads its match surface.
+    #pragma omp parallel for schedule( dynamic )
     for ( int i = 0 ; i < npt; i++ )
     {
-        TargetPt* tpt = m_TargetPts[i];
-        Geom* g = VehicleMgr.GetVehicle()->FindGeom( tpt->GetMatchGeom() );
-
-        tpt->RefineUW( g );
+        m_TargetPts[i]->RefineUW( geom_vec[i] );
     }
 }
 
@@ -675,14 +689,15 @@ void FitModelMgrSingleton::SearchTargetUW()
 {
     ValidateTargetPts();
 
+    vector < Geom* > geom_vec;
+    FindTargetGeoms( geom_vec );
+
     int npt = m_TargetPts.size();
 
+    #pragma omp parallel for schedule( dynamic )
     for ( int i = 0 ; i < npt; i++ )
     {
-        TargetPt* tpt = m_TargetPts[i];
-        Geom* g = VehicleMgr.GetVehicle()->FindGeom( tpt->GetMatchGeom() );
-
-        tpt->SearchUW( g );
+        m_TargetPts[i]->SearchUW( geom_vec[i] );
     }
 }
 
@@ -812,6 +827,7 @@ void FitModelMgrSingleton::CalcMetrics( const double *x, double *y )
 
     int npt = m_TargetPts.size();
     // Calculate target point distances
+    #pragma omp parallel for
     for ( int i = 0 ; i < npt; i++ )
     {
         TargetPt* tpt = m_TargetPts[i];
@@ -835,8 +851,6 @@ void FitModelMgrSingleton::CalcMetricDeriv( const double *x, double *y, double *
     int i, j, xindx;
     double x0, dx;
 
-    double *fprm;
-    fprm = new double[m];
     double *xp;
     xp = new double[n];
 
@@ -847,6 +861,8 @@ void FitModelMgrSingleton::CalcMetricDeriv( const double *x, double *y, double *
 
     double eps = sqrt( dpmpar( 1.0 ) ); // sqrt of machine precision
 
+    vector < int > update_cnt( npt );
+
     xindx = 0;
     for (j = 0; j < nvar; ++j)
     {
@@ -857,13 +873,35 @@ void FitModelMgrSingleton::CalcMetricDeriv( const double *x, double *y, double *
             dx = eps;
         }
 
+        for ( i = 0; i < npt; ++i )
+        {
+            update_cnt[i] = m_TargetGeomPtrVec[i]->GetUpdateCount();
+        }
+
+        // Vehicle::Update only visits Geoms dirtied by this variable (and the previous
+        // variable's restore), so only points on those Geoms need re-evaluation.
         xp[xindx] = x0 + dx;
-        FitModelMgr.CalcMetrics( xp, fprm );
+        XtoParm( xp );
+        VehicleMgr.GetVehicle()->Update( false );
         xp[xindx] = x0;
 
-        for (i = 0; i < m; ++i)
+        #pragma omp parallel for
+        for ( i = 0; i < npt; ++i )
         {
-            yprm[i + xindx * m] = (fprm[i] - y[i]) / dx;
+            Geom* g = m_TargetGeomPtrVec[i];
+            vec3d dydx;
+
+            if ( g->GetUpdateCount() != update_cnt[i] )
+            {
+                vec3d delta = m_TargetPts[i]->CalcDelta( g );
+                dydx.set_xyz( ( delta.x() - y[3 * i] ) / dx,
+                              ( delta.y() - y[3 * i + 1] ) / dx,
+                              ( delta.z() - y[3 * i + 2] ) / dx );
+            }
+
+            yprm[3 * i + xindx * m] = dydx.x();
+            yprm[3 * i + 1 + xindx * m] = dydx.y();
+            yprm[3 * i + 2 + xindx * m] = dydx.z();
         }
         xindx++;
     }
@@ -908,7 +946,6 @@ void FitModelMgrSingleton::CalcMetricDeriv( const double *x, double *y, double *
         }
     }
 
-    delete [] fprm;
     delete [] xp;
 }
 
@@ -1331,6 +1368,9 @@ void FitModelMgrSingleton::AddSelectedPts( string tgtGeomID )
         }
     }
 
+    vector< TargetPt* > newPts;
+    newPts.reserve( targetCandidates.size() );
+
     for ( int i = 0; i < ( int )targetCandidates.size(); i++ )
     {
         vec3d pt = targetCandidates[i];
@@ -1343,11 +1383,20 @@ void FitModelMgrSingleton::AddSelectedPts( string tgtGeomID )
         tpt->SetUType( veh->m_UType.Get() );
         tpt->SetWType( veh->m_WType.Get() );
 
-        Geom* g = veh->FindGeom( tpt->GetMatchGeom() );
+        newPts.push_back( tpt );
+    }
 
-        tpt->SearchUW( g );
+    Geom* g = veh->FindGeom( tgtGeomID );
 
-        AddTargetPt( tpt );
+    #pragma omp parallel for schedule( dynamic )
+    for ( int i = 0; i < ( int )newPts.size(); i++ )
+    {
+        newPts[i]->SearchUW( g );
+    }
+
+    for ( int i = 0; i < ( int )newPts.size(); i++ )
+    {
+        AddTargetPt( newPts[i] );
     }
 
     SelectNone();
@@ -287,6 +287,7 @@ private:
     void Wype();
 
     void BuildPtrVec();
+    void FindTargetGeoms( vector < Geom* > & geom_vec );
     void ParmToX( double *x );
     void XtoParm( const double *x );
     static double Clamp01( double x, bool closed );
@@ -182,7 +182,11 @@ void FuselageGeom::UpdateSurf()
         }
     }
 
-    m_MainSurfVec[0].SkinRibs( rib_vec, false );
+    if ( !RestoreCachedSkin( 0, m_MainSurfVec[0] ) )
+    {
+        m_MainSurfVec[0].SkinRibs( rib_vec, false );
+        StoreCachedSkin( 0, m_MainSurfVec[0] );
+    }
     m_MainSurfVec[0].SetMagicVParm( false );
 
     for ( int i = 0 ; i < nxsec ; i++ )
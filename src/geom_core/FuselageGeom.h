@@ -26,6 +26,8 @@ public:
     FuselageGeom( Vehicle* vehicle_ptr );
     virtual ~FuselageGeom();
 
+    virtual bool IsUpdateCacheable()                { return true; }
+
     virtual void ComputeCenter();
 
     virtual xmlNodePtr EncodeXml( xmlNodePtr & node );
@@ -1280,6 +1280,17 @@ void GeomXForm::AcceptScale()
 Geom::Geom( Vehicle* vehicle_ptr ) : GeomXForm( vehicle_ptr )
 {
     m_UpdateBlock = false;
+    m_UpdateCount = 0;
+    m_UpdateClosureFlag = false;
+
+    m_DeferredMainTessFlag = false;
+    m_DeferredTessFlag = false;
+    m_DeferredDrawObjFlag = false;
+    m_DeferredHighlightFlag = false;
+
+    m_UpdateCacheActive = false;
+    m_UpdateCacheNew = false;
+    m_UpdateCacheStamp = 0;
 
     m_Name = "Geom";
     m_Type.m_Type = GEOM_GEOM_TYPE;
@@ -1546,10 +1557,18 @@ void Geom::Update( bool fullupdate )
 
     m_UpdateBlock = true;
 
+    m_UpdateCount++;
+    m_Vehicle->CountGeomUpdate();
+
     m_LateUpdateFlag = false;
 
     m_CappingDone = false;
 
+    if ( m_SurfDirty || m_TessDirty )
+    {
+        BeginUpdateCache();
+    }
+
     if ( m_SurfDirty )
     {
         double sf = m_Scale() / m_LastScale();
@@ -1632,34 +1651,45 @@ void Geom::Update( bool fullupdate )
         // Tessellate MainSurfVec
         if ( m_SurfDirty || m_TessDirty )
         {
-            UpdateMainTessVec();
-            UpdateMainDegenGeomPreview();
+            if ( m_UpdateCacheActive && m_UpdateCacheEntry->m_DegenPreviewValid )
+            {
+                m_MainDegenGeomPreviewVec = m_UpdateCacheEntry->m_MainDegenGeomPreviewVec;
+            }
+            else
+            {
+                UpdateMainDegenGeomPreview();
+
+                if ( m_UpdateCacheActive )
+                {
+                    m_UpdateCacheEntry->m_MainDegenGeomPreviewVec = m_MainDegenGeomPreviewVec;
+                    m_UpdateCacheEntry->m_DegenPreviewValid = true;
+                }
+            }
         }
 
         // Copy Tessellation for symmetry and XForm
         if ( m_XFormDirty || m_SurfDirty || m_TessDirty )
         {
-            UpdateTessVec();
             UpdateDegenGeomPreview();
         }
-    }
 
-    if ( m_XFormDirty || m_SurfDirty )
-    {
-        UpdateBBox();  // Needs to happen for both XForm and Surf updates.
-    }
+        // Tessellation only depends on this Geom's surfaces.  During a vehicle update it is
+        // queued and run in parallel with other Geoms, followed by the DrawObj update.
+        m_DeferredMainTessFlag |= ( m_SurfDirty || m_TessDirty );
+        m_DeferredTessFlag |= ( m_XFormDirty || m_SurfDirty || m_TessDirty );
+        m_DeferredDrawObjFlag |= ( m_XFormDirty || m_SurfDirty || m_TessDirty );
+        m_DeferredHighlightFlag |= ( m_XFormDirty || m_SurfDirty || m_HighlightDirty );
 
-    if ( fullupdate )
-    {
-        if ( m_XFormDirty || m_SurfDirty || m_TessDirty )
+        if ( !m_Vehicle->DeferTess( this ) )
         {
-            UpdateDrawObj();  // Needs to happen for both XForm and Surf updates.
+            UpdateDeferredTess();
+            UpdateDeferredDrawObj();
         }
+    }
 
-        if ( m_XFormDirty || m_SurfDirty || m_HighlightDirty )
-        {
-            UpdateHighlightDrawObj();
-        }
+    if ( m_XFormDirty || m_SurfDirty )
+    {
+        UpdateBBox();  // Needs to happen for both XForm and Surf updates.
     }
 
     m_UpdateXForm = false;
@@ -1676,12 +1706,236 @@ void Geom::Update( bool fullupdate )
 
     m_HighlightDirty = false;
 
+    EndUpdateCache();
+
     UpdateChildren( fullupdate );
 
     m_UpdatedParmVec.clear();
     m_UpdateBlock = false;
 }
 
+//==== Tessellate Surfaces Flagged By Update - Safe To Run Concurrently Across Geoms ====//
+void Geom::UpdateDeferredTess()
+{
+    if ( m_DeferredMainTessFlag )
+    {
+        // Only touches this Geom's own cache entry, so safe in parallel
+        if ( m_UpdateCacheActive && m_UpdateCacheEntry->m_TessValid )
+        {
+            m_MainTessVec = m_UpdateCacheEntry->m_MainTessVec;
+            m_MainFeatureTessVec = m_UpdateCacheEntry->m_MainFeatureTessVec;
+        }
+        else
+        {
+            UpdateMainTessVec();
+
+            if ( m_UpdateCacheActive )
+            {
+                m_UpdateCacheEntry->m_MainTessVec = m_MainTessVec;
+                m_UpdateCacheEntry->m_MainFeatureTessVec = m_MainFeatureTessVec;
+                m_UpdateCacheEntry->m_TessValid = true;
+            }
+        }
+    }
+
+    if ( m_DeferredTessFlag )
+    {
+        UpdateTessVec();
+    }
+
+    m_DeferredMainTessFlag = false;
+    m_DeferredTessFlag = false;
+}
+
+//==== Update DrawObjs Flagged By Update - Main Thread Only ====//
+void Geom::UpdateDeferredDrawObj()
+{
+    if ( m_DeferredDrawObjFlag )
+    {
+        UpdateDrawObj();  // Needs to happen for both XForm and Surf updates.
+    }
+
+    if ( m_DeferredHighlightFlag )
+    {
+        UpdateHighlightDrawObj();
+    }
+
+    m_DeferredDrawObjFlag = false;
+    m_DeferredHighlightFlag = false;
+}
+
+//==== Entry Matches If Every Parm Not Set By The Update Has The Same Value ====//
+bool GeomUpdateCacheEntry::Match( std::size_t state_hash, const vector< double > & val_vec ) const
+{
+    if ( state_hash != m_StateHash || val_vec.size() != m_ParmVals.size() )
+    {
+        return false;
+    }
+
+    for ( int i = 0 ; i < ( int )val_vec.size() ; i++ )
+    {
+        if ( !m_OutputFlags[i] && val_vec[i] != m_ParmVals[i] )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void Geom::ClearUpdateCache()
+{
+    m_UpdateCache.clear();
+    m_UpdateCacheActive = false;
+    m_UpdateCacheNew = false;
+}
+
+//==== Find Cache Entry For Current Parm State Or Start A New One ====//
+void Geom::BeginUpdateCache()
+{
+    m_UpdateCacheActive = false;
+    m_UpdateCacheNew = false;
+
+    int cache_size = m_Vehicle->GetUpdateCacheSize();
+
+    if ( cache_size <= 0 || !IsUpdateCacheable() )
+    {
+        m_UpdateCache.clear();
+        return;
+    }
+
+    // Same parms that can be linked -- includes XSec, XSecCurve and PCurve parms.
+    m_UpdateCacheParmIDs.clear();
+    AddLinkableParms( m_UpdateCacheParmIDs );
+
+    std::size_t state_hash = 0;
+    vector< double > val_vec( m_UpdateCacheParmIDs.size(), 0.0 );
+    vector< ParmContainer* > pc_vec;
+
+    for ( int i = 0 ; i < ( int )m_UpdateCacheParmIDs.size() ; i++ )
+    {
+        hash_combine( state_hash, m_UpdateCacheParmIDs[i] );
+
+        Parm* p = ParmMgr.FindParm( m_UpdateCacheParmIDs[i] );
+        if ( p )
+        {
+            val_vec[i] = p->Get();
+
+            ParmContainer* pc = p->GetContainer();
+            if ( pc && !vector_contains_val( pc_vec, pc ) )
+            {
+                pc_vec.push_back( pc );
+            }
+        }
+    }
+
+    for ( int i = 0 ; i < ( int )pc_vec.size() ; i++ )
+    {
+        pc_vec[i]->HashNonParmState( state_hash );
+    }
+
+    list< GeomUpdateCacheEntry >::iterator it = m_UpdateCache.begin();
+    while ( it != m_UpdateCache.end() && !it->Match( state_hash, val_vec ) )
+    {
+        ++it;
+    }
+
+    if ( it != m_UpdateCache.end() )
+    {
+        m_UpdateCache.splice( m_UpdateCache.begin(), m_UpdateCache, it );
+        m_Vehicle->CountUpdateCache( true );
+    }
+    else
+    {
+        m_UpdateCache.push_front( GeomUpdateCacheEntry() );
+
+        GeomUpdateCacheEntry & entry = m_UpdateCache.front();
+        entry.m_StateHash = state_hash;
+        entry.m_ParmVals = val_vec;
+        entry.m_OutputFlags.assign( val_vec.size(), false );
+        entry.m_TessValid = false;
+        entry.m_DegenPreviewValid = false;
+
+        while ( ( int )m_UpdateCache.size() > cache_size )
+        {
+            m_UpdateCache.pop_back();
+        }
+
+        m_UpdateCacheNew = true;
+        m_UpdateCacheStamp = ParmMgr.GetChangeCnt();
+        m_Vehicle->CountUpdateCache( false );
+    }
+
+    m_UpdateCacheEntry = m_UpdateCache.begin();
+    m_UpdateCacheActive = true;
+}
+
+//==== Parms Set During The Update Are Outputs And Are Not Part Of The Key ====//
+void Geom::EndUpdateCache()
+{
+    if ( !m_UpdateCacheActive || !m_UpdateCacheNew )
+    {
+        return;
+    }
+
+    for ( int i = 0 ; i < ( int )m_UpdateCacheParmIDs.size() ; i++ )
+    {
+        Parm* p = ParmMgr.FindParm( m_UpdateCacheParmIDs[i] );
+        if ( p && p->GetChangeCnt() > m_UpdateCacheStamp )
+        {
+            m_UpdateCacheEntry->m_OutputFlags[i] = true;
+        }
+    }
+
+    m_UpdateCacheNew = false;
+}
+
+//==== Reuse Skinned Surface From Cache ====//
+bool Geom::RestoreCachedSkin( int indx, VspSurf & surf )
+{
+    if ( m_UpdateCacheActive )
+    {
+        map< int, VspSurf >::const_iterator it = m_UpdateCacheEntry->m_SkinMap.find( indx );
+        if ( it != m_UpdateCacheEntry->m_SkinMap.end() )
+        {
+            surf.CopySkin( it->second );
+            return true;
+        }
+    }
+    return false;
+}
+
+void Geom::StoreCachedSkin( int indx, const VspSurf & surf )
+{
+    if ( m_UpdateCacheActive )
+    {
+        m_UpdateCacheEntry->m_SkinMap[ indx ] = surf;
+    }
+}
+
+//==== Check If Update Would Do Any Work ====//
+bool Geom::UpdateNeeded()
+{
+    if ( m_XFormDirty || m_SurfDirty || m_TessDirty || m_HighlightDirty || m_LateUpdateFlag )
+    {
+        return true;
+    }
+
+    if ( ( int )m_SetFlags.size() != m_Vehicle->GetNumSets() )
+    {
+        return true;
+    }
+
+    for ( int i = 0 ; i < ( int )m_SubSurfVec.size() ; i++ )
+    {
+        if ( m_SubSurfVec[i]->GetLateUpdateFlag() )
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 void Geom::GetUWTess01( const int &indx, vector < double > &u, vector < double > &w )
 {
     vector< vector< vec3d > > pnts;
@@ -2055,11 +2309,16 @@ void Geom::UpdateChildren( bool fullupdate )
                 }
             }
 
-            // Ignore the abs location values and only use rel values for children so a child
-            // with abs button selected stays attached to parent if the parent moves
-            child->m_ignoreAbsFlag = true;
-            child->Update( fullupdate );
-            child->m_ignoreAbsFlag = false;
+            // During an incremental vehicle update, skip children that are clean and
+            // have no dirty descendants.
+            if ( !m_Vehicle->IsUpdateClosureActive() || child->m_UpdateClosureFlag || child->UpdateNeeded() )
+            {
+                // Ignore the abs location values and only use rel values for children so a child
+                // with abs button selected stays attached to parent if the parent moves
+                child->m_ignoreAbsFlag = true;
+                child->Update( fullupdate );
+                child->m_ignoreAbsFlag = false;
+            }
 
             updated_child_vec.push_back( m_ChildIDVec[i] );
         }
@@ -36,6 +36,7 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <list>
 
 class XSecSurf;
 
@@ -364,6 +365,27 @@ protected:
 
 };
 
+//==== Update Results Saved For One Parm State Of A Geom ====//
+class GeomUpdateCacheEntry
+{
+public:
+
+    bool Match( std::size_t state_hash, const vector< double > & val_vec ) const;
+
+    std::size_t m_StateHash;                // Parm IDs and non-parm state
+    vector< double > m_ParmVals;            // Parm values before update
+    vector< bool > m_OutputFlags;           // Parms set by the update itself, not compared
+
+    map< int, VspSurf > m_SkinMap;          // Skinned main surfaces by index
+
+    bool m_TessValid;
+    vector< SimpleTess > m_MainTessVec;
+    vector< SimpleFeatureTess > m_MainFeatureTessVec;
+
+    bool m_DegenPreviewValid;
+    vector< DegenGeom > m_MainDegenGeomPreviewVec;
+};
+
 //==== Geom  ====//
 class Geom : public GeomXForm
 {
@@ -373,6 +395,14 @@ public:
     virtual ~Geom();
 
     virtual void Update( bool fullupdate = true );
+    virtual bool UpdateNeeded();
+    void UpdateDeferredTess();
+    void UpdateDeferredDrawObj();
+    int GetUpdateCount()                            { return m_UpdateCount; }
+
+    //==== Optional LRU Cache Of Skinned Surfaces And Tessellation, Sized By Vehicle ====//
+    virtual bool IsUpdateCacheable()                { return false; }
+    void ClearUpdateCache();
     virtual void LoadMainDrawObjs( vector< DrawObj* > & draw_obj_vec );
     virtual void LoadDrawObjs( vector< DrawObj* > & draw_obj_vec );
 
@@ -765,9 +795,31 @@ public:
 
     virtual void ExportSurfacePatches( vector< string > &surf_res_ids );
 
+    // Set by Vehicle::Update when this Geom or one of its descendants needs update
+    bool m_UpdateClosureFlag;
+
 protected:
 
     bool m_UpdateBlock;
+    int m_UpdateCount;                              // Incremented each time Update runs
+
+    // Tessellation and DrawObj work pending from Update
+    bool m_DeferredMainTessFlag;
+    bool m_DeferredTessFlag;
+    bool m_DeferredDrawObjFlag;
+    bool m_DeferredHighlightFlag;
+
+    void BeginUpdateCache();
+    void EndUpdateCache();
+    bool RestoreCachedSkin( int indx, VspSurf & surf );
+    void StoreCachedSkin( int indx, const VspSurf & surf );
+
+    list< GeomUpdateCacheEntry > m_UpdateCache;     // Most recently used first
+    list< GeomUpdateCacheEntry >::iterator m_UpdateCacheEntry;
+    bool m_UpdateCacheActive;                       // m_UpdateCacheEntry matches current state
+    bool m_UpdateCacheNew;                          // m_UpdateCacheEntry added by this update
+    int m_UpdateCacheStamp;
+    vector< string > m_UpdateCacheParmIDs;
 
     virtual void UpdateSurf() = 0;
     void UpdateEndCaps();
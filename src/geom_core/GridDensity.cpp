@@ -401,6 +401,14 @@ double PointSimpleSource::GetTargetLen( double base_len, vec3d &  pos, const str
     return ( m_Len + fract * ( base_len - m_Len  ) );
 }
 
+bool PointSimpleSource::GetInfluenceBox( BndBox & box )
+{
+    box.Reset();
+    box.Update( m_Loc - vec3d( m_Rad, m_Rad, m_Rad ) );
+    box.Update( m_Loc + vec3d( m_Rad, m_Rad, m_Rad ) );
+    return true;
+}
+
 void PointSimpleSource::Update( Geom* geomPtr )
 {
     const VspSurf* surf = geomPtr->GetSurfPtr( m_SurfIndx );
@@ -578,6 +586,12 @@ double LineSimpleSource::GetTargetLen( double base_len, vec3d & pos, const strin
     return retlen;
 }
 
+bool LineSimpleSource::GetInfluenceBox( BndBox & box )
+{
+    box = m_Box;
+    return true;
+}
+
 void LineSimpleSource::Update( Geom* geomPtr )
 {
     const VspSurf* surf = geomPtr->GetSurfPtr( m_SurfIndx );
@@ -764,6 +778,12 @@ double BoxSimpleSource::GetTargetLen( double base_len, vec3d & pos, const string
     return ( m_Len + max_fract * ( base_len - m_Len  ) );
 }
 
+bool BoxSimpleSource::GetInfluenceBox( BndBox & box )
+{
+    box = m_Box;
+    return true;
+}
+
 void BoxSimpleSource::Update( Geom* geomPtr )
 {
     const VspSurf* surf = geomPtr->GetSurfPtr( m_SurfIndx );
@@ -184,6 +184,10 @@ public:
 
     virtual double GetTargetLen( double base_len, vec3d &  pos, const string & geomid, const int & surfindx, const double & u, const double &w ) = 0;
 
+    // Box outside of which GetTargetLen returns base_len.  Returns false if the
+    // source can not be bounded and must be evaluated everywhere.
+    virtual bool GetInfluenceBox( BndBox & box )                    { return false; }
+
     virtual void Draw()                                             {}
 
     virtual void Update( Geom* geomPtr )                            {}
@@ -217,6 +221,7 @@ public:
     virtual ~PointSimpleSource()      {}
 
     virtual double GetTargetLen( double base_len, vec3d &  pos, const string & geomid, const int & surfindx, const double & u, const double &w );
+    virtual bool GetInfluenceBox( BndBox & box );
 
     virtual void Update( Geom* geomPtr );
 
@@ -249,6 +254,7 @@ public:
     virtual void AdjustLen( double val );
 
     virtual double GetTargetLen( double base_len, vec3d &  pos, const string & geomid, const int & surfindx, const double & u, const double &w );
+    virtual bool GetInfluenceBox( BndBox & box );
 
     virtual void Update( Geom* geomPtr );
 
@@ -295,6 +301,7 @@ public:
     void ComputeCullPnts();
 
     virtual double GetTargetLen( double base_len, vec3d &  pos, const string & geomid, const int & surfindx, const double & u, const double &w );
+    virtual bool GetInfluenceBox( BndBox & box );
 
     void Update( Geom* geomPtr );
 
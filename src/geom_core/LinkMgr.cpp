@@ -24,6 +24,11 @@ LinkMgrSingleton::LinkMgrSingleton()
     m_UserParms.SetNumPredefined( m_NumPredefinedUserParms );
     m_UserParms.Renew(m_NumPredefinedUserParms);
     m_FreezeUpdateFlag = false;
+    m_NumLinkChanges = 0;
+    m_LinkGraphStamp = -1;
+    m_AdvLinkGraphStamp = -1;
+    m_LinkGraphPass = 0;
+    m_LinkUpdateActive = false;
 }
 
 void LinkMgrSingleton::Init()
@@ -50,7 +55,9 @@ void LinkMgrSingleton::Wype()
 
     DelAllLinks();
 
-    m_UpdatedParmVec = vector< string >();
+    m_LinkGraphNodeVec = vector< LinkGraphNode >();
+    m_LinkGraphParmMap.clear();
+    m_LinkGraphStamp = -1;
 
     m_BaseLinkableContainers = vector< string >();
     m_LinkableContainers = vector< string >();
@@ -146,6 +153,7 @@ void LinkMgrSingleton::CheckLinks()
     if ( num_delete > 0 )
     {
         m_CurrLinkIndex = -1;
+        m_NumLinkChanges++;
     }
 }
 
@@ -249,6 +257,7 @@ bool LinkMgrSingleton::AddLink( const string& pidA, const string& pidB, bool ini
 
     m_LinkVec.push_back( pl );
     m_CurrLinkIndex = ( int )m_LinkVec.size() - 1;
+    m_NumLinkChanges++;
 
     return true;
 }
@@ -268,6 +277,7 @@ void LinkMgrSingleton::DelCurrLink()
     delete pl;
 
     m_CurrLinkIndex = -1;
+    m_NumLinkChanges++;
 }
 
 void LinkMgrSingleton::DelLinks( const set < int > &toDel )
@@ -288,6 +298,7 @@ void LinkMgrSingleton::DelLinks( const set < int > &toDel )
     m_LinkVec = keep;
 
     m_CurrLinkIndex = -1;
+    m_NumLinkChanges++;
 }
 
 //==== Delete All Links ====//
@@ -300,6 +311,7 @@ void LinkMgrSingleton::DelAllLinks()
 
     m_LinkVec.clear();
     m_CurrLinkIndex = -1;
+    m_NumLinkChanges++;
 }
 //==== Link All Parms In A Group ====//
 bool LinkMgrSingleton::LinkAllGroup()
@@ -412,114 +424,318 @@ void LinkMgrSingleton::ParmChanged( const string& pid, bool start_flag  )
     if ( m_FreezeUpdateFlag )
         return;
 
-    //==== Check For Advanced Links ====//
-    bool adv_link_flag = AdvLinkMgr.IsInputParm( pid );
+    BuildLinkGraph();
 
-    //==== Look for Reg Links  ====//
-    vector < Link* > parm_link_vec;
-    for ( int i = 0 ; i < ( int )m_LinkVec.size() ; i++ )
+    //==== Abort if No Links ====//
+    int node = FindLinkGraphNode( pid );
+    if ( node < 0 || m_LinkGraphNodeVec[node].m_OutNodeVec.empty() )
+        return;
+
+    //==== Parm Set While Links Are Updating - Queue Its Downstream Links ====//
+    if ( m_LinkUpdateActive )
     {
-        if ( m_LinkVec[i]->GetParmA() == pid )
+        QueueLinkGraphNode( node );
+
+        if ( start_flag )
         {
-            parm_link_vec.push_back( m_LinkVec[i] );
+            m_NotifyParmVec.push_back( pid );
         }
+        return;
     }
 
-    //==== Check Links ====//
-    bool reg_link_flag = false;
-    if ( parm_link_vec.size() )
+    m_LinkUpdateActive = true;
+    m_LinkGraphPass++;
+    m_NotifyParmVec.clear();
+
+    //==== The Changed Parm Always Updates Its Links ====//
+    QueueLinkGraphNode( node );
+    UpdateLinkGraph();
+
+    m_LinkUpdateActive = false;
+
+    //==== Notify Vehicle ====//
+    if ( start_flag )
     {
-        reg_link_flag = true;
+        Vehicle* veh = VehicleMgr.GetVehicle();
+        if ( veh )
+        {
+            veh->ParmChanged( parm_ptr, Parm::SET );
+
+            for ( int i = 0 ; i < ( int )m_NotifyParmVec.size() ; i++ )
+            {
+                Parm* p = ParmMgr.FindParm( m_NotifyParmVec[i] );
+                if ( p )
+                {
+                    veh->ParmChanged( p, Parm::SET );
+                }
+            }
+        }
     }
+    m_NotifyParmVec.clear();
+}
 
-    //==== Abort if No Links ====//
-    if ( !adv_link_flag && !reg_link_flag )
+//==== Is Parm Done In The Current Link Update ====//
+bool LinkMgrSingleton::ParmUpdatedByLinks( const string& pid )
+{
+    if ( !m_LinkUpdateActive )
+    {
+        return false;
+    }
+
+    int node = FindLinkGraphNode( pid );
+    if ( node < 0 )
+    {
+        return false;
+    }
+    return m_LinkGraphNodeVec[node].m_DonePass == m_LinkGraphPass;
+}
+
+int LinkMgrSingleton::FindLinkGraphNode( const string & pid )
+{
+    unordered_map< string, int >::const_iterator iter = m_LinkGraphParmMap.find( pid );
+    if ( iter == m_LinkGraphParmMap.end() )
+    {
+        return -1;
+    }
+    return iter->second;
+}
+
+int LinkMgrSingleton::AddLinkGraphNode( const string & pid, AdvLink* adv_link )
+{
+    if ( !adv_link )
+    {
+        int node = FindLinkGraphNode( pid );
+        if ( node >= 0 )
+        {
+            return node;
+        }
+        m_LinkGraphParmMap[ pid ] = ( int )m_LinkGraphNodeVec.size();
+    }
+
+    LinkGraphNode gn;
+    gn.m_ParmID = pid;
+    gn.m_AdvLink = adv_link;
+    gn.m_Rank = 0;
+    gn.m_DonePass = 0;
+    gn.m_QueuePass = 0;
+    m_LinkGraphNodeVec.push_back( gn );
+
+    return ( int )m_LinkGraphNodeVec.size() - 1;
+}
+
+//==== Build Graph Of Parms And Adv Links Connected By Links ====//
+void LinkMgrSingleton::BuildLinkGraph()
+{
+    //==== Keep Graph Fixed While Links Are Updating ====//
+    if ( m_LinkUpdateActive )
+    {
+        return;
+    }
+
+    if ( m_LinkGraphStamp == m_NumLinkChanges && m_AdvLinkGraphStamp == AdvLinkMgr.GetNumLinkChanges() )
+    {
         return;
+    }
 
-    //==== Set Link Update Flag ====//
-    parm_ptr->SetLinkUpdateFlag( true );
-    m_UpdatedParmVec.push_back( parm_ptr->GetID() );
+    m_LinkGraphStamp = m_NumLinkChanges;
+    m_AdvLinkGraphStamp = AdvLinkMgr.GetNumLinkChanges();
 
-    //==== Update Linked Parms ====//
-    for ( int i = 0 ; i < ( int )parm_link_vec.size() ; i++ )
+    m_LinkGraphNodeVec.clear();
+    m_LinkGraphParmMap.clear();
+    m_LinkGraphPass = 0;
+
+    for ( int i = 0 ; i < ( int )m_LinkVec.size() ; i++ )
     {
-        Link* pl = parm_link_vec[i];
-        Parm* pB = ParmMgr.FindParm( pl->GetParmB() );
+        int na = AddLinkGraphNode( m_LinkVec[i]->GetParmA(), NULL );
+        int nb = AddLinkGraphNode( m_LinkVec[i]->GetParmB(), NULL );
 
-        if ( pB && ! pB->GetLinkUpdateFlag() )       // Prevent Circular
+        m_LinkGraphNodeVec[na].m_LinkVec.push_back( m_LinkVec[i] );
+        m_LinkGraphNodeVec[na].m_OutNodeVec.push_back( nb );
+    }
+
+    vector< AdvLink* > adv_link_vec = AdvLinkMgr.GetLinks();
+    for ( int i = 0 ; i < ( int )adv_link_vec.size() ; i++ )
+    {
+        int n = AddLinkGraphNode( string(), adv_link_vec[i] );
+
+        const vector< VarDef > & in_vec = adv_link_vec[i]->GetInputVars();
+        for ( int j = 0 ; j < ( int )in_vec.size() ; j++ )
         {
-            double offset = 0.0;
-            if ( pl->GetOffsetFlag() )
-            {
-                offset = pl->m_Offset();
-            }
-            double scale = 1.0;
-            if ( pl->GetScaleFlag() )
-            {
-                scale = pl->m_Scale();
-            }
+            int nin = AddLinkGraphNode( in_vec[j].m_ParmID, NULL );
+            m_LinkGraphNodeVec[nin].m_OutNodeVec.push_back( n );
+        }
+
+        const vector< VarDef > & out_vec = adv_link_vec[i]->GetOutputVars();
+        for ( int j = 0 ; j < ( int )out_vec.size() ; j++ )
+        {
+            int nout = AddLinkGraphNode( out_vec[j].m_ParmID, NULL );
+            m_LinkGraphNodeVec[n].m_OutNodeVec.push_back( nout );
+        }
+    }
+
+    //==== Rank Nodes By Reverse Post Order Of A Depth First Search ====//
+    //==== A Back Edge Closes A Loop - Warn Once Here, Not On Every Update ====//
+    int num_nodes = ( int )m_LinkGraphNodeVec.size();
+    vector< int > state( num_nodes, 0 );                // 0 - New, 1 - On Stack, 2 - Finished
+    vector< pair< int, int > > stack;                   // Node, Next Out Edge
+    int rank = num_nodes;
+    int loop_node = -1;
+
+    for ( int i = 0 ; i < num_nodes ; i++ )
+    {
+        if ( state[i] != 0 )
+        {
+            continue;
+        }
+
+        stack.push_back( make_pair( i, 0 ) );
+        state[i] = 1;
 
-            double val = parm_ptr->Get() * scale + offset;
+        while ( !stack.empty() )
+        {
+            int n = stack.back().first;
+            int e = stack.back().second;
 
-            if ( pl->GetLowerLimitFlag() && val < pl->m_LowerLimit() )      // Constraints
+            if ( e < ( int )m_LinkGraphNodeVec[n].m_OutNodeVec.size() )
             {
-                val = pl->m_LowerLimit();
-            }
+                stack.back().second++;
 
-            if ( pl->GetUpperLimitFlag() && val > pl->m_UpperLimit() )      // Constraints
+                int next = m_LinkGraphNodeVec[n].m_OutNodeVec[e];
+                if ( state[next] == 0 )
+                {
+                    state[next] = 1;
+                    stack.push_back( make_pair( next, 0 ) );
+                }
+                else if ( state[next] == 1 && loop_node < 0 )
+                {
+                    loop_node = next;
+                }
+            }
+            else
             {
-                val = pl->m_UpperLimit();
+                state[n] = 2;
+                m_LinkGraphNodeVec[n].m_Rank = --rank;
+                stack.pop_back();
             }
-
-            pB->SetFromLink( val );
         }
-        else if ( pB )
+    }
+
+    if ( loop_node >= 0 )
+    {
+        string name;
+        string id = m_LinkGraphNodeVec[loop_node].m_ParmID;
+        if ( m_LinkGraphNodeVec[loop_node].m_AdvLink )
         {
-            MessageData errMsgData;
-            errMsgData.m_String = "Error";
-
-            errMsgData.m_IntVec.push_back( vsp::VSP_LINK_LOOP_DETECTED );
-            char buf[255];
-            snprintf( buf, sizeof( buf ), "Warning: Updating link output variable '%s' (%s) would initiate a link loop.  Stopping.\n", pB->GetName().c_str(), pB->GetID().c_str() );
-            errMsgData.m_StringVec.emplace_back( string( buf ) );
-            MessageMgr::getInstance().SendAll( errMsgData );
+            name = m_LinkGraphNodeVec[loop_node].m_AdvLink->GetName();
         }
-        else
+        else if ( ParmMgr.FindParm( id ) )
         {
-            MessageData errMsgData;
-            errMsgData.m_String = "Error";
-
-            errMsgData.m_IntVec.push_back( vsp::VSP_CANT_FIND_PARM );
-            char buf[255];
-            snprintf( buf, sizeof( buf ), "Error: Link Output parm '%s' not found.\n", pl->GetParmB().c_str() );
-            errMsgData.m_StringVec.emplace_back( string( buf ) );
-            MessageMgr::getInstance().SendAll( errMsgData );
+            name = ParmMgr.FindParm( id )->GetName();
         }
+
+        MessageData errMsgData;
+        errMsgData.m_String = "Error";
+
+        errMsgData.m_IntVec.push_back( vsp::VSP_LINK_LOOP_DETECTED );
+        char buf[255];
+        snprintf( buf, sizeof( buf ), "Warning: Links form a loop through '%s' (%s).  Each parm will only be updated once per change.\n", name.c_str(), id.c_str() );
+        errMsgData.m_StringVec.emplace_back( string( buf ) );
+        MessageMgr::getInstance().SendAll( errMsgData );
     }
+}
 
-    //==== Update Adv Link ===//
-    if ( adv_link_flag )
+//==== Add Node To Update Queue (Once Per Update) ====//
+void LinkMgrSingleton::QueueLinkGraphNode( int node )
+{
+    LinkGraphNode & gn = m_LinkGraphNodeVec[node];
+
+    if ( gn.m_DonePass == m_LinkGraphPass || gn.m_QueuePass == m_LinkGraphPass )
     {
-        AdvLinkMgr.UpdateLinks( pid );
+        return;
     }
 
-    //==== Clean Up ====/
-    if ( start_flag )      
+    gn.m_QueuePass = m_LinkGraphPass;
+    m_LinkUpdateQueue.insert( make_pair( gn.m_Rank, node ) );
+}
+
+//==== Update Queued Nodes In Topological Order ====//
+void LinkMgrSingleton::UpdateLinkGraph()
+{
+    while ( !m_LinkUpdateQueue.empty() )
     {
-        for ( int i = 0 ; i < ( int )m_UpdatedParmVec.size() ; i++ )
+        int n = m_LinkUpdateQueue.begin()->second;
+        m_LinkUpdateQueue.erase( m_LinkUpdateQueue.begin() );
+
+        m_LinkGraphNodeVec[n].m_DonePass = m_LinkGraphPass;
+
+        //==== Adv Link - Run Script Once All Changed Inputs Are Done ====//
+        AdvLink* adv_link = m_LinkGraphNodeVec[n].m_AdvLink;
+        if ( adv_link )
+        {
+            adv_link->ForceUpdate();
+            continue;
+        }
+
+        Parm* parm_ptr = ParmMgr.FindParm( m_LinkGraphNodeVec[n].m_ParmID );
+        if ( !parm_ptr )
         {
-            Parm* p = ParmMgr.FindParm( m_UpdatedParmVec[i] );
-            if ( p )
+            continue;
+        }
+
+        //==== Adv Links Using This Parm ====//
+        for ( int i = 0 ; i < ( int )m_LinkGraphNodeVec[n].m_OutNodeVec.size() ; i++ )
+        {
+            int next = m_LinkGraphNodeVec[n].m_OutNodeVec[i];
+            if ( m_LinkGraphNodeVec[next].m_AdvLink )
             {
-                p->SetLinkUpdateFlag( false );
+                QueueLinkGraphNode( next );
             }
         }
-        m_UpdatedParmVec.clear();
 
-        Vehicle* veh = VehicleMgr.GetVehicle();
-        if ( veh )
+        //==== Update Linked Parms - SetFromLink Queues Their Nodes ====//
+        for ( int i = 0 ; i < ( int )m_LinkGraphNodeVec[n].m_LinkVec.size() ; i++ )
         {
-            veh->ParmChanged( parm_ptr, Parm::SET );
+            Link* pl = m_LinkGraphNodeVec[n].m_LinkVec[i];
+            Parm* pB = ParmMgr.FindParm( pl->GetParmB() );
+
+            if ( pB && !ParmUpdatedByLinks( pB->GetID() ) )       // Loops Are Reported In BuildLinkGraph
+            {
+                double offset = 0.0;
+                if ( pl->GetOffsetFlag() )
+                {
+                    offset = pl->m_Offset();
+                }
+                double scale = 1.0;
+                if ( pl->GetScaleFlag() )
+                {
+                    scale = pl->m_Scale();
+                }
+
+                double val = parm_ptr->Get() * scale + offset;
+
+                if ( pl->GetLowerLimitFlag() && val < pl->m_LowerLimit() )      // Constraints
+                {
+                    val = pl->m_LowerLimit();
+                }
+
+                if ( pl->GetUpperLimitFlag() && val > pl->m_UpperLimit() )      // Constraints
+                {
+                    val = pl->m_UpperLimit();
+                }
+
+                pB->SetFromLink( val );
+            }
+            else if ( !pB )
+            {
+                MessageData errMsgData;
+                errMsgData.m_String = "Error";
+
+                errMsgData.m_IntVec.push_back( vsp::VSP_CANT_FIND_PARM );
+                char buf[255];
+                snprintf( buf, sizeof( buf ), "Error: Link Output parm '%s' not found.\n", pl->GetParmB().c_str() );
+                errMsgData.m_StringVec.emplace_back( string( buf ) );
+                MessageMgr::getInstance().SendAll( errMsgData );
+            }
         }
     }
 }
@@ -804,9 +1020,11 @@ bool LinkNameCompareB( const Link *lnkA, const Link *lnkB )
 void LinkMgrSingleton::SortLinksByA()
 {
     std::sort( m_LinkVec.begin(), m_LinkVec.end(), LinkNameCompareA );
+    m_NumLinkChanges++;
 }
 
 void LinkMgrSingleton::SortLinksByB()
 {
     std::sort( m_LinkVec.begin(), m_LinkVec.end(), LinkNameCompareB );
+    m_NumLinkChanges++;
 }
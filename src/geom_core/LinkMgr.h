@@ -15,10 +15,14 @@
 #include "UserParmContainer.h"
 #include <deque>
 #include <set>
+#include <unordered_map>
 using std::string;
 using std::vector;
 using std::deque;
 using std::set;
+using std::unordered_map;
+
+class AdvLink;
 
 //==== Parm Link Manager ====//
 class LinkMgrSingleton
@@ -47,8 +51,9 @@ public:
     virtual bool UsedInLink( const string & pid );
 
     virtual bool AddLink( const string& pA, const string& pB, bool init_link_parms = true );         // Link Two Parms
-    virtual void AddLink( Link* link )                      {  m_LinkVec.push_back( link ); }
+    virtual void AddLink( Link* link )                      {  m_LinkVec.push_back( link ); m_NumLinkChanges++; }
     virtual void ParmChanged( const string& pid, bool start_flag );     // A Parm Has Changed Check Links
+    virtual bool ParmUpdatedByLinks( const string& pid );               // Parm Already Set In Current Link Update
 
     virtual void SetCurrLinkIndex( int i )                  { m_CurrLinkIndex = i; }
     virtual int  GetCurrLinkIndex()                         { return m_CurrLinkIndex; }
@@ -124,7 +129,35 @@ private:
 
     vector< Link* > m_LinkVec;
 
-    vector< string > m_UpdatedParmVec;      // Keep Track Of Linked Parm To Prevent Circular Links
+    int m_NumLinkChanges;                   // Bumped On Any Change To m_LinkVec
+
+    //==== Link Graph - Parms And Adv Links Are Nodes, Links Are Edges ====//
+    class LinkGraphNode
+    {
+    public:
+        string m_ParmID;                    // Empty For Adv Link Nodes
+        AdvLink* m_AdvLink;
+        vector< Link* > m_LinkVec;          // Links With This Parm As Parm A
+        vector< int > m_OutNodeVec;         // Downstream Nodes
+        int m_Rank;                         // Position In Topological Order
+        int m_QueuePass;                    // Last Update Pass This Node Was Queued
+        int m_DonePass;                     // Last Update Pass This Node Was Updated
+    };
+
+    void BuildLinkGraph();
+    int FindLinkGraphNode( const string & pid );
+    int AddLinkGraphNode( const string & pid, AdvLink* adv_link );
+    void QueueLinkGraphNode( int node );
+    void UpdateLinkGraph();
+
+    vector< LinkGraphNode > m_LinkGraphNodeVec;
+    unordered_map< string, int > m_LinkGraphParmMap;    // Parm ID -> Node Index
+    int m_LinkGraphStamp;
+    int m_AdvLinkGraphStamp;
+    int m_LinkGraphPass;
+    bool m_LinkUpdateActive;
+    set< pair< int, int > > m_LinkUpdateQueue;          // Rank, Node Index
+    vector< string > m_NotifyParmVec;                   // Parms Set By Device During Link Update
 
     vector< string > m_BaseLinkableContainers;              // Base Registered Parm Containers
     vector< string > m_LinkableContainers;                  // All valid Linkable Container
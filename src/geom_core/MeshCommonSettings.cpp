@@ -468,6 +468,9 @@ StructSettings::StructSettings() : MeshCommonSettings()
     m_BeamPerElementNormal.Init( "BeamPerElementNormal", "StructSettings", this, true, false, true );
     m_BeamPerElementNormal.SetDescript( "Flag to write per-element beam element normals instead of per-part for CalculiX." );
 
+    m_IncrementalRemeshFlag.Init( "IncrementalRemeshFlag", "StructSettings", this, false, false, true );
+    m_IncrementalRemeshFlag.SetDescript( "Flag to reuse surface meshes from the previous run when their remesh inputs are unchanged" );
+
     m_ExportFileNames.resize( vsp::FEA_NUM_FILE_NAMES );
 }
 
@@ -598,6 +601,9 @@ AssemblySettings::AssemblySettings() : ParmContainer()
     m_DrawElementOrientVecFlag.Init( "DrawElementOrientVecFlag", "StructSettings", this, false, false, true );
     m_DrawElementOrientVecFlag.SetDescript( "Flag to Draw FeaElement Orientation Vectors" );
 
+    m_ConcurrentMeshFlag.Init( "ConcurrentMeshFlag", "StructSettings", this, false, false, true );
+    m_ConcurrentMeshFlag.SetDescript( "Flag to mesh the assembly's structures concurrently" );
+
     m_ExportFileNames.resize( vsp::FEA_NUM_FILE_NAMES );
 }
 
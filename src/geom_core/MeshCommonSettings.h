@@ -204,6 +204,8 @@ public:
 
     BoolParm m_BeamPerElementNormal;
 
+    BoolParm m_IncrementalRemeshFlag;
+
 protected:
 
     // These file names do not get written to file.  They are reset each time
@@ -243,6 +245,8 @@ public:
     BoolParm m_DrawBCNodesFlag;
     BoolParm m_DrawElementOrientVecFlag;
 
+    BoolParm m_ConcurrentMeshFlag;
+
 protected:
 
     // These file names do not get written to file.  They are reset each time
@@ -107,7 +107,7 @@ xmlNodePtr MeshGeom::EncodeXml( xmlNodePtr & node )
     XmlUtil::AddIntNode( mesh_node, "Num_Meshes", ( int )m_TMeshVec.size() );
     for ( int i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
     {
-        m_TMeshVec[i]->EncodeXml( mesh_node );
+        m_TMeshVec[i]->EncodeXml( mesh_node, m_Vehicle->m_BinaryMeshFlag() );
     }
 
     return mesh_node;
@@ -32,7 +32,6 @@ Parm::Parm()
     m_UpperLimit =  1.0e16;
     m_LowerLimit = -1.0e16;
     m_ActiveFlag = true;
-    m_LinkUpdateFlag = false;
     m_ChangeCnt = 0;
 }
 
@@ -134,15 +134,6 @@ public:
         return m_ActiveFlag;
     }
 
-    virtual void SetLinkUpdateFlag( bool flag )
-    {
-        m_LinkUpdateFlag = flag;
-    }
-    virtual bool GetLinkUpdateFlag() const
-    {
-        return m_LinkUpdateFlag;
-    }
-
     virtual void SetLinkContainerID( const string & id )
     {
         m_LinkContainerID = id;
@@ -177,7 +168,6 @@ protected:
     double m_UpperLimit;
 
     bool m_ActiveFlag;
-    bool m_LinkUpdateFlag;  // Used to identify actively updating Parms to prevent circular updates.
     string m_LinkContainerID;
 
     virtual string GenerateID();
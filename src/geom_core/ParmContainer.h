@@ -45,6 +45,7 @@ public:
     virtual ParmContainer* GetParentContainerPtr() const;
 
     virtual void SetLateUpdateFlag( bool flag )     { m_LateUpdateFlag = flag; }
+    virtual bool GetLateUpdateFlag() const          { return m_LateUpdateFlag; }
     virtual int GetLatestChangeCnt();
 
     virtual string GetID() const                    { return m_ID; }
@@ -69,6 +70,9 @@ public:
     virtual void SetParentContainer( const string & id )    { m_ParentContainer = id; }
 
     virtual void CopyVals( ParmContainer *from );
+
+    // Mix in any state that affects geometry but is not held in Parms (e.g. file points)
+    virtual void HashNonParmState( std::size_t & seed ) const    {}
 protected:
 
     string m_ID;                                        // Unique ID
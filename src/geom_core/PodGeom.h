@@ -22,6 +22,8 @@ public:
     PodGeom( Vehicle* vehicle_ptr );
     virtual ~PodGeom();
 
+    virtual bool IsUpdateCacheable()                { return true; }
+
     virtual void ComputeCenter();
     virtual void Scale();
     virtual void AddDefaultSources( double base_len = 1.0 );
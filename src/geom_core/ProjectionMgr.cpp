@@ -281,6 +281,86 @@ Results* ProjectionMgrSingleton::Project( const string &tgeom, string bgeom, con
     return res;
 }
 
+Results* ProjectionMgrSingleton::ProjectMulti( int tset, const vector < vec3d > & dirvec )
+{
+    vector < TMesh* > targetTMeshVec;
+    vector < TMesh* > boundaryTMeshVec;
+
+    GetMesh( tset, targetTMeshVec );
+
+    Results* res = ProjectMulti( targetTMeshVec, boundaryTMeshVec, dirvec );
+    CleanMesh( targetTMeshVec );
+    return res;
+}
+
+Results* ProjectionMgrSingleton::ProjectMulti( int tset, int bset, const vector < vec3d > & dirvec )
+{
+    vector < TMesh* > targetTMeshVec;
+    vector < TMesh* > boundaryTMeshVec;
+
+    GetMesh( tset, targetTMeshVec );
+    GetMesh( bset, boundaryTMeshVec );
+
+    Results* res = ProjectMulti( targetTMeshVec, boundaryTMeshVec, dirvec );
+    CleanMesh( targetTMeshVec );
+    CleanMesh( boundaryTMeshVec );
+    return res;
+}
+
+Results* ProjectionMgrSingleton::ProjectMulti( int tset, string bgeom, const vector < vec3d > & dirvec )
+{
+    vector < TMesh* > targetTMeshVec;
+    vector < TMesh* > boundaryTMeshVec;
+
+    GetMesh( tset, targetTMeshVec );
+    GetMesh( bgeom, boundaryTMeshVec );
+
+    Results* res = ProjectMulti( targetTMeshVec, boundaryTMeshVec, dirvec );
+    CleanMesh( targetTMeshVec );
+    CleanMesh( boundaryTMeshVec );
+    return res;
+}
+
+Results* ProjectionMgrSingleton::ProjectMulti( const string &tgeom, const vector < vec3d > & dirvec )
+{
+    vector < TMesh* > targetTMeshVec;
+    vector < TMesh* > boundaryTMeshVec;
+
+    GetMesh( tgeom, targetTMeshVec );
+
+    Results* res = ProjectMulti( targetTMeshVec, boundaryTMeshVec, dirvec );
+    CleanMesh( targetTMeshVec );
+    return res;
+}
+
+Results* ProjectionMgrSingleton::ProjectMulti( const string &tgeom, int bset, const vector < vec3d > & dirvec )
+{
+    vector < TMesh* > targetTMeshVec;
+    vector < TMesh* > boundaryTMeshVec;
+
+    GetMesh( tgeom, targetTMeshVec );
+    GetMesh( bset, boundaryTMeshVec );
+
+    Results* res = ProjectMulti( targetTMeshVec, boundaryTMeshVec, dirvec );
+    CleanMesh( targetTMeshVec );
+    CleanMesh( boundaryTMeshVec );
+    return res;
+}
+
+Results* ProjectionMgrSingleton::ProjectMulti( const string &tgeom, string bgeom, const vector < vec3d > & dirvec )
+{
+    vector < TMesh* > targetTMeshVec;
+    vector < TMesh* > boundaryTMeshVec;
+
+    GetMesh( tgeom, targetTMeshVec );
+    GetMesh( bgeom, boundaryTMeshVec );
+
+    Results* res = ProjectMulti( targetTMeshVec, boundaryTMeshVec, dirvec );
+    CleanMesh( targetTMeshVec );
+    CleanMesh( boundaryTMeshVec );
+    return res;
+}
+
 Results* ProjectionMgrSingleton::Project( vector < TMesh* > &targetTMeshVec, const vec3d & dir )
 {
     Matrix4d mat;
@@ -484,6 +564,166 @@ Results* ProjectionMgrSingleton::Project( vector < TMesh* > &targetTMeshVec, vec
     return res;
 }
 
+Results* ProjectionMgrSingleton::ProjectMulti( vector < TMesh* > &targetTMeshVec, vector < TMesh* > &boundaryTMeshVec, const vector < vec3d > & dirvec )
+{
+    // Group target triangles by component, ids sorted to match Union().
+    vector < string > ids( targetTMeshVec.size() );
+    for ( int i = 0; i < ( int )targetTMeshVec.size(); i++ )
+    {
+        ids[i] = targetTMeshVec[i]->m_OriginGeomID;
+    }
+
+    vector < string > uids = ids;
+    std::sort( uids.begin(), uids.end() );
+    uids.erase( std::unique( uids.begin(), uids.end() ), uids.end() );
+
+    vector < vector < vec3d > > comppnts( uids.size() );
+    for ( int i = 0; i < ( int )uids.size(); i++ )
+    {
+        vector < TMesh* > comptmv;
+        for ( int j = 0; j < ( int )ids.size(); j++ )
+        {
+            if ( uids[i] == ids[j] )
+            {
+                comptmv.push_back( targetTMeshVec[j] );
+            }
+        }
+        MeshToTriPnts( comptmv, comppnts[i] );
+    }
+
+    vector < vec3d > boundarypnts;
+    MeshToTriPnts( boundaryTMeshVec, boundarypnts );
+
+    bool bounded = !boundaryTMeshVec.empty();
+
+    int ndir = dirvec.size();
+
+    vector < vector < double > > compareas( ndir );
+    vector < vector < double > > compbareas( ndir );
+    vector < double > areas( ndir, 0.0 );
+    vector < double > bareas( ndir, 0.0 );
+
+    #pragma omp parallel for schedule( dynamic )
+    for ( int i = 0; i < ndir; i++ )
+    {
+        vec3d dir = dirvec[i];
+        dir.normalize();
+
+        ProjectDirection( comppnts, boundarypnts, dir, compareas[i], compbareas[i], areas[i], bareas[i] );
+    }
+
+    //==== Create Results ====//
+    Results* res = ResultsMgr.CreateResults( "Projection_Multi", "Projected area results for multiple directions." );
+
+    Vehicle* veh = VehicleMgr.GetVehicle();
+
+    vector < string > namevec( uids.size() );
+    for ( int i = 0; i < uids.size(); i++ )
+    {
+        Geom *g = veh->FindGeom( uids[i] );
+        if ( g )
+        {
+            namevec[i] = g->GetName();
+        }
+    }
+
+    res->Add( NameValData( "Comp_Names", namevec, "Names of target Geoms." ) );
+    res->Add( NameValData( "Comp_IDs", uids, "GeomID's of target Geoms." ) );
+    res->Add( NameValData( "Direction", dirvec, "Projection direction vectors." ) );
+
+    res->Add( NameValData( "Comp_Areas", compareas, "Component projected areas, indexed by direction then component." ) );
+
+    if ( bounded )
+    {
+        res->Add( NameValData( "Boundary_Area", bareas, "Boundary projected area for each direction." ) );
+        res->Add( NameValData( "Comp_Bounded_Areas", compbareas, "Bounded component projected areas, indexed by direction then component." ) );
+        res->Add( NameValData( "Area", areas, "Bounded projected area for each direction." ) );
+    }
+    else
+    {
+        res->Add( NameValData( "Area", areas, "Projected area for each direction." ) );
+    }
+
+    return res;
+}
+
+void ProjectionMgrSingleton::ProjectDirection( const vector < vector < vec3d > > & comppnts, const vector < vec3d > & boundarypnts, const vec3d & dir,
+                                               vector < double > & compareas, vector < double > & compbareas, double & area, double & barea )
+{
+    int ncomp = comppnts.size();
+
+    compareas.assign( ncomp, 0.0 );
+    compbareas.assign( ncomp, 0.0 );
+    area = 0.0;
+    barea = 0.0;
+
+    Matrix4d mat;
+    mat.rotatealongX( dir );
+
+    //==== Local Bounding Box, m_BBox Is Shared Between Threads ====//
+    BndBox bbox;
+    for ( int i = 0; i < ncomp; i++ )
+    {
+        for ( int j = 0; j < ( int )comppnts[i].size(); j++ )
+        {
+            bbox.Update( mat.xform( comppnts[i][j] ) );
+        }
+    }
+    for ( int j = 0; j < ( int )boundarypnts.size(); j++ )
+    {
+        bbox.Update( mat.xform( boundarypnts[j] ) );
+    }
+
+    if ( bbox.GetLargestDist() <= 0.0 )
+    {
+        return;
+    }
+
+    vec3d center = bbox.GetCenter();
+    double scale = 1e8 / bbox.GetLargestDist();
+
+    Matrix4d toclipper;
+    toclipper.loadIdentity();
+    toclipper.scale( scale );
+    toclipper.translatef( -center.x(), -center.y(), -center.z() );
+
+    double ascale = 1.0 / ( scale * scale );
+
+    vector < Clipper2Lib::Paths64 > utargetvec( ncomp );
+    for ( int i = 0; i < ncomp; i++ )
+    {
+        Clipper2Lib::Paths64 pths;
+        TriPntsToPaths( comppnts[i], mat, toclipper, pths );
+        UnionTree( pths, utargetvec[i] );
+
+        compareas[i] = Clipper2Lib::Area( utargetvec[i] ) * ascale;
+    }
+
+    if ( !boundarypnts.empty() )
+    {
+        Clipper2Lib::Paths64 boundary, bunion;
+        TriPntsToPaths( boundarypnts, mat, toclipper, boundary );
+        UnionTree( boundary, bunion );
+
+        barea = Clipper2Lib::Area( bunion ) * ascale;
+
+        vector < Clipper2Lib::Paths64 > solvec;
+        Intersect( utargetvec, bunion, solvec );
+
+        for ( int i = 0; i < ncomp; i++ )
+        {
+            compbareas[i] = Clipper2Lib::Area( solvec[i] ) * ascale;
+        }
+
+        utargetvec.swap( solvec );
+    }
+
+    Clipper2Lib::Paths64 solution;
+    UnionTree( utargetvec, solution );
+
+    area = Clipper2Lib::Area( solution ) * ascale;
+}
+
 bool TMeshCompare( TMesh* a, TMesh* b )
 {
     return ( a->m_OriginGeomID < b->m_OriginGeomID );
@@ -717,6 +957,51 @@ void ProjectionMgrSingleton::MeshToPathsVec( const vector < TMesh* > & tmv, vect
     }
 }
 
+void ProjectionMgrSingleton::MeshToTriPnts( const vector < TMesh* > & tmv, vector < vec3d > & pnts )
+{
+    unsigned int ntri = 0;
+    for ( int i = 0 ; i < ( int )tmv.size() ; i++ )
+    {
+        ntri += tmv[i]->m_TVec.size();
+    }
+
+    pnts.clear();
+    pnts.reserve( 3 * ntri );
+
+    for ( int i = 0 ; i < ( int )tmv.size() ; i++ )
+    {
+        for ( int j = 0 ; j < ( int )tmv[i]->m_TVec.size() ; j++ )
+        {
+            for ( int k = 0; k < 3; k++ )
+            {
+                pnts.push_back( tmv[i]->m_TVec[j]->GetTriNode( k )->m_Pnt );
+            }
+        }
+    }
+}
+
+void ProjectionMgrSingleton::TriPntsToPaths( const vector < vec3d > & pnts, const Matrix4d & mat, const Matrix4d & toclip, Clipper2Lib::Paths64 & pths )
+{
+    int ntri = pnts.size() / 3;
+    pths.resize( ntri );
+
+    for ( int i = 0 ; i < ntri ; i++ )
+    {
+        pths[i].resize( 3 );
+
+        for ( int k = 0; k < 3; k++ )
+        {
+            vec3d p = toclip.xform( mat.xform( pnts[ 3 * i + k ] ) );
+            pths[i][k] = Clipper2Lib::Point64( (int) p.y(), (int) p.z() );
+        }
+
+        if ( !Clipper2Lib::IsPositive( pths[i] ) )
+        {
+            std::reverse( pths[i].begin(), pths[i].end() );
+        }
+    }
+}
+
 void ProjectionMgrSingleton::PathsToPolyVec( const Clipper2Lib::Paths64 & pths, vector < vector < vec3d > > & polyvec, const int keepdir1, const int keepdir2 )
 {
     polyvec.clear();
@@ -850,6 +1135,62 @@ void ProjectionMgrSingleton::Union( vector < Clipper2Lib::Paths64 > & pthsvec, v
     ids = uids;
 }
 
+void ProjectionMgrSingleton::UnionTree( const Clipper2Lib::Paths64 & pths, Clipper2Lib::Paths64 & sol )
+{
+    // Union small batches of triangles first, then merge the batches pairwise.
+    const int nbatch = 64;
+
+    vector < Clipper2Lib::Paths64 > pthsvec;
+    pthsvec.reserve( pths.size() / nbatch + 1 );
+
+    for ( int i = 0; i < ( int )pths.size(); i += nbatch )
+    {
+        Clipper2Lib::Paths64 batch( pths.begin() + i, pths.begin() + min( i + nbatch, ( int )pths.size() ) );
+
+        pthsvec.push_back( Clipper2Lib::Paths64() );
+        Union( batch, pthsvec.back() );
+    }
+
+    UnionTree( pthsvec, sol );
+}
+
+void ProjectionMgrSingleton::UnionTree( vector < Clipper2Lib::Paths64 > & pthsvec, Clipper2Lib::Paths64 & sol )
+{
+    // Partial unions carry their holes as negative paths, so the positive fill rule
+    // gives the same result as one union of all triangles.
+    vector < Clipper2Lib::Paths64 > level = pthsvec;
+
+    while ( level.size() > 1 )
+    {
+        vector < Clipper2Lib::Paths64 > next( ( level.size() + 1 ) / 2 );
+
+        for ( int i = 0; i < ( int )next.size(); i++ )
+        {
+            Clipper2Lib::Paths64 pth = level[ 2 * i ];
+            if ( 2 * i + 1 < ( int )level.size() )
+            {
+                pth.insert( pth.end(), level[ 2 * i + 1 ].begin(), level[ 2 * i + 1 ].end() );
+            }
+            Union( pth, next[i] );
+        }
+
+        level.swap( next );
+    }
+
+    if ( level.empty() )
+    {
+        sol.clear();
+    }
+    else if ( pthsvec.size() == 1 )
+    {
+        Union( level[0], sol );
+    }
+    else
+    {
+        sol = level[0];
+    }
+}
+
 void ProjectionMgrSingleton::Intersect( Clipper2Lib::Paths64 & pthA, Clipper2Lib::Paths64 & pthB, Clipper2Lib::Paths64 & sol )
 {
     Clipper2Lib::Clipper64 clpr;
@@ -65,6 +65,16 @@ public:
     virtual Results* Project( const string &tgeom, int bset, const vec3d & dir );
     virtual Results* Project( const string &tgeom, string bgeom, const vec3d & dir );
 
+    // Projected areas for many directions at once, directions are processed in parallel.
+    // No MeshGeom or solution paths are created.
+    virtual Results* ProjectMulti( int tset, const vector < vec3d > & dirvec );
+    virtual Results* ProjectMulti( int tset, int bset, const vector < vec3d > & dirvec );
+    virtual Results* ProjectMulti( int tset, string bgeom, const vector < vec3d > & dirvec );
+
+    virtual Results* ProjectMulti( const string &tgeom, const vector < vec3d > & dirvec );
+    virtual Results* ProjectMulti( const string &tgeom, int bset, const vector < vec3d > & dirvec );
+    virtual Results* ProjectMulti( const string &tgeom, string bgeom, const vector < vec3d > & dirvec );
+
     virtual string MakeMeshGeom();
 
     virtual void ExportProjectLines( vector < TMesh* > targetTMeshVec );
@@ -113,6 +123,9 @@ protected:
     virtual void Union( vector < Clipper2Lib::Paths64 > & pthsvec,  Clipper2Lib::Paths64 & sol );
     virtual void Union( vector < Clipper2Lib::Paths64 > & pthsvec, vector < Clipper2Lib::Paths64 > & solvec, vector < string > & ids );
 
+    virtual void UnionTree( const Clipper2Lib::Paths64 & pths, Clipper2Lib::Paths64 & sol );
+    virtual void UnionTree( vector < Clipper2Lib::Paths64 > & pthsvec, Clipper2Lib::Paths64 & sol );
+
     virtual void Intersect( Clipper2Lib::Paths64 & pthA, Clipper2Lib::Paths64 & pthB, Clipper2Lib::Paths64 & sol );
     virtual void Intersect( vector < Clipper2Lib::Paths64 > & pthsvecA, Clipper2Lib::Paths64 & pthB, vector < Clipper2Lib::Paths64 > & solvec );
 
@@ -129,6 +142,15 @@ protected:
     virtual Results* Project( vector < TMesh* > &targetTMeshVec, const vec3d & dir );
     virtual Results* Project( vector < TMesh* > &targetTMeshVec, vector < TMesh* > &boundaryTMeshVec, const vec3d & dir );
 
+    virtual Results* ProjectMulti( vector < TMesh* > &targetTMeshVec, vector < TMesh* > &boundaryTMeshVec, const vector < vec3d > & dirvec );
+
+    virtual void MeshToTriPnts( const vector < TMesh* > & tmv, vector < vec3d > & pnts );
+    virtual void TriPntsToPaths( const vector < vec3d > & pnts, const Matrix4d & mat, const Matrix4d & toclip, Clipper2Lib::Paths64 & pths );
+
+    // Uses no member data, safe to call concurrently for different directions.
+    virtual void ProjectDirection( const vector < vector < vec3d > > & comppnts, const vector < vec3d > & boundarypnts, const vec3d & dir,
+                                   vector < double > & compareas, vector < double > & compbareas, double & area, double & barea );
+
     BndBox m_BBox;
 
 private:
@@ -1274,7 +1274,11 @@ void PropGeom::UpdateSurf()
         m_MainSurfVec.resize( 1 );
 
         m_MainSurfVec[0].SetMagicVParm( false );
-        m_MainSurfVec[0].SkinCubicSpline(rib_vec, m_UPseudo, tdisc, false );
+        if ( !RestoreCachedSkin( 0, m_MainSurfVec[0] ) )
+        {
+            m_MainSurfVec[0].SkinCubicSpline(rib_vec, m_UPseudo, tdisc, false );
+            StoreCachedSkin( 0, m_MainSurfVec[0] );
+        }
 
         m_MainSurfVec[0].SetMagicVParm( true );
         m_MainSurfVec[0].SetSurfType( WING_SURF );
@@ -94,6 +94,8 @@ public:
     PropGeom( Vehicle* vehicle_ptr );
     virtual ~PropGeom();
 
+    virtual bool IsUpdateCacheable()                { return true; }
+
     virtual void UpdateDrawObj();
     virtual void UpdateHighlightDrawObj();
     virtual void LoadDrawObjs( vector< DrawObj* > & draw_obj_vec );
@@ -257,10 +257,24 @@ xmlNodePtr PtCloudGeom::EncodeXml( xmlNodePtr & node )
     // required too much memory to read in.
     // XmlUtil::AddVectorVec3dNode( ptcloud_node, "Points" , m_Pts );
 
-    xmlNodePtr pt_list_node = xmlNewChild( ptcloud_node, NULL, BAD_CAST "Pt_List", NULL );
-    for ( int i = 0 ; i < ( int ) m_Pts.size() ; i++ )
+    if ( m_Vehicle->m_BinaryMeshFlag() )
     {
-        XmlUtil::AddVec3dNode( pt_list_node, "Pt", m_Pts[i] );
+        vector< double > xyz( 3 * m_Pts.size() );
+        for ( int i = 0 ; i < ( int ) m_Pts.size() ; i++ )
+        {
+            xyz[ 3 * i ] = m_Pts[i].x();
+            xyz[ 3 * i + 1 ] = m_Pts[i].y();
+            xyz[ 3 * i + 2 ] = m_Pts[i].z();
+        }
+        XmlUtil::AddVectorDoubleBinaryNode( ptcloud_node, "Pt_Data", xyz );
+    }
+    else
+    {
+        xmlNodePtr pt_list_node = xmlNewChild( ptcloud_node, NULL, BAD_CAST "Pt_List", NULL );
+        for ( int i = 0 ; i < ( int ) m_Pts.size() ; i++ )
+        {
+            XmlUtil::AddVec3dNode( pt_list_node, "Pt", m_Pts[i] );
+        }
     }
 
     return ptcloud_node;
@@ -296,6 +310,14 @@ xmlNodePtr PtCloudGeom::DecodeXml( xmlNodePtr & node )
                 iter_node = iter_node->next;
             }
         }
+
+        // Read in binary encoding if it exists.
+        vector< double > xyz = XmlUtil::ExtractVectorDoubleBinaryNode( ptcloud_node, "Pt_Data" );
+        m_Pts.reserve( m_Pts.size() + xyz.size() / 3 );
+        for ( int i = 0 ; i + 2 < ( int ) xyz.size() ; i += 3 )
+        {
+            m_Pts.push_back( vec3d( xyz[i], xyz[i + 1], xyz[i + 2] ) );
+        }
     }
     InitPts();
 
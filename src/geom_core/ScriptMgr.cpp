@@ -2992,6 +2992,42 @@ void ScriptMgrSingleton::RegisterAPI( asIScriptEngine* se )
     assert( r >= 0 );
 
 
+    r = se->RegisterGlobalFunction( "void SetGeomUpdateCacheSize( int size )", asFUNCTION( vsp::SetGeomUpdateCacheSize ), asCALL_CDECL );
+    assert( r >= 0 );
+
+
+    r = se->RegisterGlobalFunction( "int GetGeomUpdateCacheHits()", asFUNCTION( vsp::GetGeomUpdateCacheHits ), asCALL_CDECL );
+    assert( r >= 0 );
+
+
+    r = se->RegisterGlobalFunction( "int GetGeomUpdateCacheMisses()", asFUNCTION( vsp::GetGeomUpdateCacheMisses ), asCALL_CDECL );
+    assert( r >= 0 );
+
+
+    r = se->RegisterGlobalFunction( "void ResetGeomUpdateCacheStats()", asFUNCTION( vsp::ResetGeomUpdateCacheStats ), asCALL_CDECL );
+    assert( r >= 0 );
+
+
+    r = se->RegisterGlobalFunction( "double GetLastUpdateClosureTime()", asFUNCTION( vsp::GetLastUpdateClosureTime ), asCALL_CDECL );
+    assert( r >= 0 );
+
+
+    r = se->RegisterGlobalFunction( "double GetLastUpdateGeomTime()", asFUNCTION( vsp::GetLastUpdateGeomTime ), asCALL_CDECL );
+    assert( r >= 0 );
+
+
+    r = se->RegisterGlobalFunction( "double GetLastUpdateTessTime()", asFUNCTION( vsp::GetLastUpdateTessTime ), asCALL_CDECL );
+    assert( r >= 0 );
+
+
+    r = se->RegisterGlobalFunction( "double GetLastUpdateMgrTime()", asFUNCTION( vsp::GetLastUpdateMgrTime ), asCALL_CDECL );
+    assert( r >= 0 );
+
+
+    r = se->RegisterGlobalFunction( "int GetLastUpdateNumGeoms()", asFUNCTION( vsp::GetLastUpdateNumGeoms ), asCALL_CDECL );
+    assert( r >= 0 );
+
+
     r = se->RegisterGlobalFunction( "void VSPExit( int error_code )", asFUNCTION( vsp::VSPExit ), asCALL_CDECL );
     assert( r >= 0 ); // TODO: Example
 
@@ -177,7 +177,11 @@ void StackGeom::UpdateSurf()
     }
 
 
-    m_MainSurfVec[0].SkinRibs( rib_vec, false );
+    if ( !RestoreCachedSkin( 0, m_MainSurfVec[0] ) )
+    {
+        m_MainSurfVec[0].SkinRibs( rib_vec, false );
+        StoreCachedSkin( 0, m_MainSurfVec[0] );
+    }
     m_MainSurfVec[0].SetMagicVParm( false );
 
     for ( int i = 0 ; i < nxsec ; i++ )
@@ -25,6 +25,8 @@ public:
     StackGeom( Vehicle* vehicle_ptr );
     virtual ~StackGeom();
 
+    virtual bool IsUpdateCacheable()                { return true; }
+
     virtual void ComputeCenter();
 
     virtual xmlNodePtr EncodeXml( xmlNodePtr & node );
@@ -201,6 +201,8 @@ void SubSurface::UpdateDrawObjs()
 
 void SubSurface::Update()
 {
+    m_LateUpdateFlag = false;
+
     if ( m_MainSurfIndx() < 0 )
     {
         return;
@@ -445,11 +445,18 @@ void TMesh::CopyAttributes( TMesh* m )
     m_AreaCenter = m->m_AreaCenter;
 }
 
-xmlNodePtr TMesh::EncodeXml( xmlNodePtr & node )
+xmlNodePtr TMesh::EncodeXml( xmlNodePtr & node, bool binary )
 {
     xmlNodePtr tmesh_node = xmlNewChild( node, NULL, BAD_CAST "TMesh", NULL );
     XmlUtil::AddIntNode( tmesh_node, "Num_Tris", ( int )m_TVec.size() );
-    EncodeTriList( tmesh_node );
+    if ( binary )
+    {
+        EncodeTriData( tmesh_node );
+    }
+    else
+    {
+        EncodeTriList( tmesh_node );
+    }
     return tmesh_node;
 }
 
@@ -471,6 +478,13 @@ xmlNodePtr TMesh::EncodeTriList( xmlNodePtr & node )
 
 void TMesh::DecodeXml( xmlNodePtr & node )
 {
+    xmlNodePtr tri_data_node = XmlUtil::GetNode( node, "Tri_Data", 0 );
+    if ( tri_data_node )
+    {
+        DecodeTriData( tri_data_node, XmlUtil::FindInt( node, "Num_Tris", 0 ) );
+        return;
+    }
+
     xmlNodePtr tri_list_node = XmlUtil::GetNode( node, "Tri_List", 0 );
     if ( tri_list_node )
     {
@@ -529,6 +543,111 @@ void TMesh::DecodeTriList( xmlNodePtr & node, int num_tris )
     }
 }
 
+//==== Indexed Vertices And Per Tri Normals As Base64 Arrays ====//
+xmlNodePtr TMesh::EncodeTriData( xmlNodePtr & node )
+{
+    xmlNodePtr tri_data_node = xmlNewChild( node, NULL, BAD_CAST "Tri_Data", NULL );
+
+    int ntri = m_TVec.size();
+
+    vector< vec3d > pnts( 3 * ntri );
+    vector< double > norms( 3 * ntri );
+    for ( int i = 0 ; i < ntri ; i++ )
+    {
+        pnts[ 3 * i ] = m_TVec[i]->m_N0->m_Pnt;
+        pnts[ 3 * i + 1 ] = m_TVec[i]->m_N1->m_Pnt;
+        pnts[ 3 * i + 2 ] = m_TVec[i]->m_N2->m_Pnt;
+        for ( int k = 0 ; k < 3 ; k++ )
+        {
+            norms[ 3 * i + k ] = m_TVec[i]->m_Norm[k];
+        }
+    }
+
+    //==== Share Exactly Coincident Vertices ====//
+    vector< int > order( pnts.size() );
+    for ( int i = 0 ; i < ( int )order.size() ; i++ )
+    {
+        order[i] = i;
+    }
+    std::sort( order.begin(), order.end(), [ &pnts ]( int a, int b )
+    {
+        for ( int k = 0 ; k < 3 ; k++ )
+        {
+            if ( pnts[a][k] != pnts[b][k] )
+            {
+                return pnts[a][k] < pnts[b][k];
+            }
+        }
+        return a < b;
+    } );
+
+    vector< int > tris( pnts.size() );
+    vector< double > nodes;
+    nodes.reserve( pnts.size() );
+    int nnode = 0;
+    for ( int i = 0 ; i < ( int )order.size() ; i++ )
+    {
+        const vec3d & p = pnts[ order[i] ];
+        if ( i == 0 || p != pnts[ order[ i - 1 ] ] )
+        {
+            nodes.push_back( p.x() );
+            nodes.push_back( p.y() );
+            nodes.push_back( p.z() );
+            nnode++;
+        }
+        tris[ order[i] ] = nnode - 1;
+    }
+
+    XmlUtil::SetIntProp( tri_data_node, "Num_Nodes", nnode );
+    XmlUtil::AddVectorDoubleBinaryNode( tri_data_node, "Nodes", nodes );
+    XmlUtil::AddVectorIntBinaryNode( tri_data_node, "Tris", tris );
+    XmlUtil::AddVectorDoubleBinaryNode( tri_data_node, "Norms", norms );
+
+    return tri_data_node;
+}
+
+void TMesh::DecodeTriData( xmlNodePtr & node, int num_tris )
+{
+    vector< double > nodes = XmlUtil::ExtractVectorDoubleBinaryNode( node, "Nodes" );
+    vector< int > tris = XmlUtil::ExtractVectorIntBinaryNode( node, "Tris" );
+    vector< double > norms = XmlUtil::ExtractVectorDoubleBinaryNode( node, "Norms" );
+
+    int nnode = nodes.size() / 3;
+    int ntri = min( tris.size(), norms.size() ) / 3;
+    if ( num_tris > 0 )
+    {
+        ntri = min( ntri, num_tris );
+    }
+
+    // Nodes are not shared between tris in memory, matching DecodeTriList.
+    m_TVec.reserve( m_TVec.size() + ntri );
+    m_NVec.reserve( m_NVec.size() + 3 * ntri );
+
+    for ( int i = 0 ; i < ntri ; i++ )
+    {
+        TTri* tri = new TTri( this );
+        TNode* n[3];
+
+        for ( int k = 0 ; k < 3 ; k++ )
+        {
+            int ind = tris[ 3 * i + k ];
+            n[k] = new TNode();
+            if ( ind >= 0 && ind < nnode )
+            {
+                n[k]->m_Pnt.set_xyz( nodes[ 3 * ind ], nodes[ 3 * ind + 1 ], nodes[ 3 * ind + 2 ] );
+            }
+            m_NVec.push_back( n[k] );
+        }
+
+        tri->m_N0 = n[0];
+        tri->m_N1 = n[1];
+        tri->m_N2 = n[2];
+        tri->m_Norm.set_xyz( norms[ 3 * i ], norms[ 3 * i + 1 ], norms[ 3 * i + 2 ] );
+
+        m_TVec.push_back( tri );
+    }
+}
+
 void TMesh::LoadGeomAttributes( const Geom* geomPtr )
 {
     /*color       = geomPtr->getColor();
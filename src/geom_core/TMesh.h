@@ -371,10 +371,12 @@ public:
 
     void copy( TMesh* m );
     void CopyFlatten( TMesh* m );
-    virtual xmlNodePtr EncodeXml( xmlNodePtr & node );
+    virtual xmlNodePtr EncodeXml( xmlNodePtr & node, bool binary = false );
     virtual void DecodeXml( xmlNodePtr & node );
     virtual xmlNodePtr EncodeTriList( xmlNodePtr & node );
     virtual void DecodeTriList( xmlNodePtr & node, int num_tris );
+    virtual xmlNodePtr EncodeTriData( xmlNodePtr & node );
+    virtual void DecodeTriData( xmlNodePtr & node, int num_tris );
 
     void LoadGeomAttributes( const Geom* geomPtr );
     int  RemoveDegenerate();
@@ -25,6 +25,10 @@
 #include "FileUtil.h"
 #include "SubSurfaceMgr.h"
 
+#ifdef VSPAERO_LIBRARY
+#include "VSP_Library.H"
+#endif
+
 //==== Constructor ====//
 VspAeroControlSurf::VspAeroControlSurf()
 {
@@ -123,6 +127,7 @@ VSPAEROMgrSingleton::VSPAEROMgrSingleton() : ParmContainer()
     UpdateFilenames();
 
     m_SolverProcessKill = false;
+    m_SolverLibraryRunning = false;
 
     // Plot limits
     m_ConvergenceXMinIsManual.Init( "m_ConvergenceXMinIsManual", groupname, this, 0, 0, 1 );
@@ -194,6 +199,8 @@ VSPAEROMgrSingleton::VSPAEROMgrSingleton() : ParmContainer()
     m_Precondition.SetDescript( "Preconditioner Choice" );
     m_KTCorrection.Init( "KTCorrection", groupname, this, false, false, true );
     m_KTCorrection.SetDescript( "Activate 2nd Order Karman-Tsien Mach Number Correction" );
+    m_SolverLibraryFlag.Init( "SolverLibraryFlag", groupname, this, true, false, true );
+    m_SolverLibraryFlag.SetDescript( "Solve Plain Steady Cases In Process When the Solver Library is Linked" );
     m_Symmetry.Init( "Symmetry", groupname, this, false, false, true );
     m_Symmetry.SetDescript( "Toggle X-Z Symmetry to Improve Calculation Time" );
     m_Write2DFEMFlag.Init( "Write2DFEMFlag", groupname, this, false, false, true );
@@ -365,6 +372,7 @@ void VSPAEROMgrSingleton::Renew()
 
     m_Precondition.Set( vsp::PRECON_MATRIX );
     m_KTCorrection.Set( false );
+    m_SolverLibraryFlag.Set( true );
     m_Symmetry.Set( false );
     m_StabilityType.Set( vsp::STABILITY_OFF );
 
@@ -2090,48 +2098,69 @@ string VSPAEROMgrSingleton::ComputeSolverBatch( FILE * logFile )
         // Add model file name
         args.push_back( modelNameBase );
 
-        //Print out execute command
-        string cmdStr = ProcessUtil::PrettyCmd( veh->GetVSPAEROPath(), veh->GetVSPAEROCmd(), args );
-        if( logFile )
+        if ( CanUseSolverLibrary() )
         {
-            fprintf( logFile, "%s", cmdStr.c_str() );
+            string msgStr = "Solving " + modelNameBase + " in process\n";
+            if( logFile )
+            {
+                fprintf( logFile, "%s", msgStr.c_str() );
+            }
+            else
+            {
+                MessageData data;
+                data.m_String = "VSPAEROSolverMessage";
+                data.m_StringVec.push_back( msgStr );
+                MessageMgr::getInstance().Send( "ScreenMgr", NULL, data );
+            }
+
+            // Forces and loads come back in memory, only the history is read from file
+            ComputeSolverLibrary( modelNameBase, historyFileName, res_id_vector, analysisMethod, recref );
         }
         else
         {
-            MessageData data;
-            data.m_String = "VSPAEROSolverMessage";
-            data.m_StringVec.push_back( cmdStr );
-            MessageMgr::getInstance().Send( "ScreenMgr", NULL, data );
-        }
+            //Print out execute command
+            string cmdStr = ProcessUtil::PrettyCmd( veh->GetVSPAEROPath(), veh->GetVSPAEROCmd(), args );
+            if( logFile )
+            {
+                fprintf( logFile, "%s", cmdStr.c_str() );
+            }
+            else
+            {
+                MessageData data;
+                data.m_String = "VSPAEROSolverMessage";
+                data.m_StringVec.push_back( cmdStr );
+                MessageMgr::getInstance().Send( "ScreenMgr", NULL, data );
+            }
 
-        // Execute VSPAero
-        m_SolverProcess.ForkCmd( veh->GetVSPAEROPath(), veh->GetVSPAEROCmd(), args );
+            // Execute VSPAero
+            m_SolverProcess.ForkCmd( veh->GetVSPAEROPath(), veh->GetVSPAEROCmd(), args );
 
-        // ==== MonitorSolverProcess ==== //
-        MonitorProcess( logFile, &m_SolverProcess, "VSPAEROSolverMessage" );
+            // ==== MonitorSolverProcess ==== //
+            MonitorProcess( logFile, &m_SolverProcess, "VSPAEROSolverMessage" );
 
-        // Check if the kill solver flag has been raised, if so clean up and return
-        //  note: we could have exited the IsRunning loop if the process was killed
-        if( m_SolverProcessKill )
-        {
-            m_SolverProcessKill = false;    //reset kill flag
+            // Check if the kill solver flag has been raised, if so clean up and return
+            //  note: we could have exited the IsRunning loop if the process was killed
+            if( m_SolverProcessKill )
+            {
+                m_SolverProcessKill = false;    //reset kill flag
 
-            return string();    //return empty result ID vector
-        }
+                return string();    //return empty result ID vector
+            }
 
-        //====== Read in all of the results ======//
-        ReadHistoryFile( historyFileName, res_id_vector, analysisMethod, recref );
+            //====== Read in all of the results ======//
+            ReadHistoryFile( historyFileName, res_id_vector, analysisMethod, recref );
 
-        if ( stabilityType == vsp::STABILITY_OFF )
-        {
-            ReadPolarFile( polarFileName, res_id_vector, recref ); // Must be after *.history file is read to generate results for multiple ReCref values
-        }
+            if ( stabilityType == vsp::STABILITY_OFF )
+            {
+                ReadPolarFile( polarFileName, res_id_vector, recref ); // Must be after *.history file is read to generate results for multiple ReCref values
+            }
 
-        ReadLoadFile( loadFileName, res_id_vector, analysisMethod );
+            ReadLoadFile( loadFileName, res_id_vector, analysisMethod );
 
-        if ( stabilityType != vsp::STABILITY_OFF )
-        {
-            ReadStabFile( stabFileName, res_id_vector, analysisMethod, stabilityType );      //*.STAB stability coeff file
+            if ( stabilityType != vsp::STABILITY_OFF )
+            {
+                ReadStabFile( stabFileName, res_id_vector, analysisMethod, stabilityType );      //*.STAB stability coeff file
+            }
         }
 
         // CpSlice *.adb File and slices are defined
@@ -2194,7 +2223,7 @@ void VSPAEROMgrSingleton::AddResultHeader( string res_id, double mach, double al
 // helper thread functions for VSPAERO GUI interface and multi-threaded impleentation
 bool VSPAEROMgrSingleton::IsSolverRunning()
 {
-    return m_SolverProcess.IsRunning();
+    return m_SolverProcess.IsRunning() || m_SolverLibraryRunning;
 }
 
 void VSPAEROMgrSingleton::KillSolver()
@@ -2209,6 +2238,409 @@ ProcessUtil* VSPAEROMgrSingleton::GetSolverProcess()
     return &m_SolverProcess;
 }
 
+/* CanUseSolverLibrary()
+True if vspaero is linked in, allowed by m_SolverLibraryFlag, and the case is a
+plain steady solve.  Stability, unsteady, ground effect, rotor, control surface,
+and Cp slice (quad tree) cases still run the executable.
+*/
+bool VSPAEROMgrSingleton::CanUseSolverLibrary()
+{
+#ifdef VSPAERO_LIBRARY
+    if ( !m_SolverLibraryFlag() )
+    {
+        return false;
+    }
+
+    if ( m_StabilityType() != vsp::STABILITY_OFF || m_RotateBladesFlag() || m_GroundEffectToggle() || m_Write2DFEMFlag() )
+    {
+        return false;
+    }
+
+    // The library has no quad tree inputs, so slices written to the setup file would be lost
+    if ( m_CpSliceFlag() && m_CpSliceVec.size() > 0 )
+    {
+        return false;
+    }
+
+    if ( m_ActuatorDiskFlag() )
+    {
+        for ( size_t iRotor = 0; iRotor < m_RotorDiskVec.size(); iRotor++ )
+        {
+            if ( m_RotorDiskVec[iRotor]->m_IsUsed )
+            {
+                return false;
+            }
+        }
+    }
+
+    if ( m_AnalysisMethod() != vsp::PANEL )
+    {
+        for ( size_t iCSG = 0; iCSG < m_ControlSurfaceGroupVec.size(); iCSG++ )
+        {
+            if ( m_ControlSurfaceGroupVec[iCSG]->m_IsUsed() && m_ControlSurfaceGroupVec[iCSG]->m_ControlSurfVec.size() > 0 )
+            {
+                return false;
+            }
+        }
+    }
+
+    // vspaero exits on a missing geometry file, which would take OpenVSP down with it
+    return FileExist( m_ModelNameBase + ".vspgeom" );
+#else
+    return false;
+#endif
+}
+
+/* ComputeSolverLibrary()
+Run the setup file cases through the linked in solver.  Polar and load results
+are built from the solver data in memory; the history file is still written
+and read since it carries the wake iteration convergence.
+*/
+void VSPAEROMgrSingleton::ComputeSolverLibrary( string modelNameBase, string historyFileName, vector <string> &res_id_vector, vsp::VSPAERO_ANALYSIS_METHOD analysisMethod, double recref )
+{
+#ifdef VSPAERO_LIBRARY
+    vector<double> alphaVec;
+    vector<double> betaVec;
+    vector<double> machVec;
+    vector<double> recrefVec;
+    GetSweepVectors( alphaVec, betaVec, machVec, recrefVec );
+
+    // History results lead, as they do when the files are read after the executable
+    size_t history_index = res_id_vector.size();
+    vector < vector < double > > recrefCases; // Beta, Mach, Alpha, ReCref, CDo, CDtot, L/D
+
+    // The solver closes its output files when it goes out of scope, so the
+    // history file is complete before it is read below
+    {
+        VSP_LIBRARY solver;
+
+        solver.SetReferenceQuantities( m_Sref(), m_cref(), m_bref() );
+        solver.SetCG( m_Xcg(), m_Ycg(), m_Zcg() );
+
+        solver.SetMachList( machVec.size(), machVec.data() );
+        solver.SetAoAList( alphaVec.size(), alphaVec.data() );
+        solver.SetBetaList( betaVec.size(), betaVec.data() );
+        solver.SetReCrefList( recrefVec.size(), recrefVec.data() );
+
+        solver.Vinf() = m_Vinf();
+
+        if ( m_ManualVrefFlag() )
+        {
+            solver.SetVref( m_Vref(), m_Machref() );
+        }
+
+        solver.Density() = m_Rho();
+        solver.ClMax() = m_ClMax();
+        solver.MaxTurningAngle() = m_MaxTurnAngle();
+        solver.SetSymmetry( m_Symmetry() ? "Y" : "NO" );
+        solver.FarDist() = m_FarDist();
+        solver.NumberOfWakeNodes() = m_NumWakeNodes();
+
+        if ( m_FixedWakeFlag() )
+        {
+            solver.WakeIterations() = 0;
+        }
+        else
+        {
+            solver.WakeIterations() = m_WakeNumIter.Get();
+        }
+
+        if ( m_Precondition() == vsp::PRECON_JACOBI )
+        {
+            solver.SetPreconditioner( "Jacobi" );
+        }
+        else if ( m_Precondition() == vsp::PRECON_SSOR )
+        {
+            solver.SetPreconditioner( "SSOR" );
+        }
+        else
+        {
+            solver.SetPreconditioner( "Matrix" );
+        }
+
+        solver.KarmanTsienCorrection() = m_KTCorrection() ? 1 : 0;
+        solver.NumberOfThreads() = m_NCPU.Get();
+
+        m_SolverLibraryRunning = true;
+
+        solver.Solve( modelNameBase.c_str() );
+
+        m_SolverLibraryRunning = false;
+
+        // The solve can not be interrupted, but a kill request still discards the results
+        if ( m_SolverProcessKill )
+        {
+            m_SolverProcessKill = false;    //reset kill flag
+            return;
+        }
+
+        // Cases are numbered with ReCref varying fastest, so every num_recref'th case shares a ReCref
+        int num_case = solver.NumberOfCases();
+        int num_recref = recrefVec.size();
+
+        //====== Polar results, grouped by ReCref as in the *.polar file ======//
+        Results* res = ResultsMgr.CreateResults( "VSPAERO_Polar", "VSPAERO polar file results." );
+
+        if ( res )
+        {
+            std::vector<double> Beta;
+            std::vector<double> Mach;
+            std::vector<double> Alpha;
+            std::vector<double> Re_1e6;
+            std::vector<double> CL;
+            std::vector<double> CDo;
+            std::vector<double> CDi;
+            std::vector<double> CDtot;
+            std::vector<double> CDt;
+            std::vector<double> CDtott;
+            std::vector<double> CS;
+            std::vector<double> L_D;
+            std::vector<double> E;
+            std::vector<double> CFx;
+            std::vector<double> CFy;
+            std::vector<double> CFz;
+            std::vector<double> CMx;
+            std::vector<double> CMy;
+            std::vector<double> CMz;
+            std::vector<double> CMl;
+            std::vector<double> CMm;
+            std::vector<double> CMn;
+            std::vector<double> Fopt;
+
+            for ( int p = 1; p <= num_recref; p++ )
+            {
+                for ( int c = p; c <= num_case; c += num_recref )
+                {
+                    Beta.push_back( solver.Beta( c ) );
+                    Mach.push_back( solver.Mach( c ) );
+                    Alpha.push_back( solver.AoA( c ) );
+                    Re_1e6.push_back( solver.ReCref( c ) / 1e6 );
+                    CL.push_back( solver.CL( c ) );
+                    CDo.push_back( solver.CDo( c ) );
+                    CDi.push_back( solver.CDi( c ) );
+                    CDtot.push_back( solver.CDtot( c ) );
+                    CDt.push_back( solver.CDt( c ) );
+                    CDtott.push_back( solver.CDtot_t( c ) );
+                    CS.push_back( solver.CS( c ) );
+                    L_D.push_back( solver.LoD( c ) );
+                    E.push_back( solver.E( c ) );
+                    CFx.push_back( solver.CFx( c ) );
+                    CFy.push_back( solver.CFy( c ) );
+                    CFz.push_back( solver.CFz( c ) );
+                    CMx.push_back( solver.CMx( c ) );
+                    CMy.push_back( solver.CMy( c ) );
+                    CMz.push_back( solver.CMz( c ) );
+                    CMl.push_back( solver.CMl( c ) );
+                    CMm.push_back( solver.CMm( c ) );
+                    CMn.push_back( solver.CMn( c ) );
+                    Fopt.push_back( 0.0 );
+
+                    recrefCases.push_back( { Beta.back(), Mach.back(), Alpha.back(), solver.ReCref( c ), CDo.back(), CDtot.back(), L_D.back() } );
+                }
+            }
+
+            res->Add( NameValData( "Beta", Beta, "Angle of sideslip." ) );
+            res->Add( NameValData( "Mach", Mach, "Mach number." ) );
+            res->Add( NameValData( "Alpha", Alpha, "Angle of attack." ) );
+            res->Add( NameValData( "Re_1e6", Re_1e6, "Reynolds number in millions." ) );
+            res->Add( NameValData( "CL", CL, "Lift coefficient." ) );
+            res->Add( NameValData( "CDo", CDo, "Parasite drag coefficient." ) );
+            res->Add( NameValData( "CDi", CDi, "Induced drag coefficient." ) );
+            res->Add( NameValData( "CDtot", CDtot, "Total drag coefficient." ) );
+            res->Add( NameValData( "CDt", CDt, "Induced drag coefficient from Trefftz-like calculation." ) );
+            res->Add( NameValData( "CDtott", CDtott, "Total drag coefficient from Trefftz-like calculation." ) );
+            res->Add( NameValData( "CS", CS, "Side force coefficient." ) );
+            res->Add( NameValData( "L_D", L_D, "Lift to drag ratio." ) );
+            res->Add( NameValData( "E", E, "Oswald efficiency factor." ) );
+            res->Add( NameValData( "CFx", CFx, "X force coefficient." ) );
+            res->Add( NameValData( "CFy", CFy, "Y force coefficient." ) );
+            res->Add( NameValData( "CFz", CFz, "Z force coefficient." ) );
+            res->Add( NameValData( "CMx", CMx, "X moment coefficient." ) );
+            res->Add( NameValData( "CMy", CMy, "Y moment coefficient." ) );
+            res->Add( NameValData( "CMz", CMz, "Z moment coefficient." ) );
+            res->Add( NameValData( "CMl", CMl, "L roll moment coefficient." ) );
+            res->Add( NameValData( "CMm", CMm, "M pitch moment coefficient." ) );
+            res->Add( NameValData( "CMn", CMn, "N yaw moment coefficient." ) );
+            res->Add( NameValData( "Fopt", Fopt, "Objective function value." ) );
+
+            res_id_vector.push_back( res->GetID() );
+        }
+
+        //====== Load results, one set per solved case as in the *.lod file ======//
+        double cref = m_cref();
+
+        for ( int c = 1; c <= num_case; c += num_recref )
+        {
+            res = ResultsMgr.CreateResults( "VSPAERO_Load", "VSPAERO load distribution lod file results." );
+            res_id_vector.push_back( res->GetID() );
+
+            res->Add( NameValData( "FC_Sref_", m_Sref(), "#Auto parsed case flight condition." ) );
+            res->Add( NameValData( "FC_Cref_", m_cref(), "#Auto parsed case flight condition." ) );
+            res->Add( NameValData( "FC_Bref_", m_bref(), "#Auto parsed case flight condition." ) );
+            res->Add( NameValData( "FC_Xcg_", m_Xcg(), "#Auto parsed case flight condition." ) );
+            res->Add( NameValData( "FC_Ycg_", m_Ycg(), "#Auto parsed case flight condition." ) );
+            res->Add( NameValData( "FC_Zcg_", m_Zcg(), "#Auto parsed case flight condition." ) );
+            res->Add( NameValData( "FC_Mach_", solver.Mach( c ), "#Auto parsed case flight condition." ) );
+            res->Add( NameValData( "FC_AoA_", solver.AoA( c ), "#Auto parsed case flight condition." ) );
+            res->Add( NameValData( "FC_Beta_", solver.Beta( c ), "#Auto parsed case flight condition." ) );
+            res->Add( NameValData( "FC_Rho_", m_Rho(), "#Auto parsed case flight condition." ) );
+            res->Add( NameValData( "FC_Vinf_", m_Vinf(), "#Auto parsed case flight condition." ) );
+            res->Add( NameValData( "FC_Roll__Rate", 0.0, "#Auto parsed case flight condition." ) );
+            res->Add( NameValData( "FC_Pitch_Rate", 0.0, "#Auto parsed case flight condition." ) );
+            res->Add( NameValData( "FC_Yaw___Rate", 0.0, "#Auto parsed case flight condition." ) );
+
+            AddResultHeader( res->GetID(), solver.Mach( c ), solver.AoA( c ), solver.Beta( c ), analysisMethod );
+
+            // Sectional distribution table
+            int num_station = solver.NumberOfSpanStations( c );
+
+            std::vector<int> WingId( num_station );
+            std::vector<double> S( num_station );
+            std::vector<double> Xavg( num_station );
+            std::vector<double> Yavg( num_station );
+            std::vector<double> Zavg( num_station );
+            std::vector<double> Chord( num_station );
+            std::vector<double> VoVref( num_station );
+            std::vector<double> Cl( num_station );
+            std::vector<double> Cd( num_station );
+            std::vector<double> Cs( num_station );
+            std::vector<double> Cx( num_station );
+            std::vector<double> Cy( num_station );
+            std::vector<double> Cz( num_station );
+            std::vector<double> Cmx( num_station );
+            std::vector<double> Cmy( num_station );
+            std::vector<double> Cmz( num_station );
+
+            for ( int i = 0; i < num_station; i++ )
+            {
+                WingId[i] = solver.SpanLoad_Wing( c, i + 1 );
+                S[i] = solver.SpanLoad_S( c, i + 1 );
+                Xavg[i] = solver.SpanLoad_Xavg( c, i + 1 );
+                Yavg[i] = solver.SpanLoad_Yavg( c, i + 1 );
+                Zavg[i] = solver.SpanLoad_Zavg( c, i + 1 );
+                Chord[i] = solver.SpanLoad_Chord( c, i + 1 );
+                VoVref[i] = solver.SpanLoad_VoVref( c, i + 1 );
+                Cl[i] = solver.SpanLoad_Cl( c, i + 1 );
+                Cd[i] = solver.SpanLoad_Cd( c, i + 1 );
+                Cs[i] = solver.SpanLoad_Cs( c, i + 1 );
+                Cx[i] = solver.SpanLoad_Cx( c, i + 1 );
+                Cy[i] = solver.SpanLoad_Cy( c, i + 1 );
+                Cz[i] = solver.SpanLoad_Cz( c, i + 1 );
+                Cmx[i] = solver.SpanLoad_Cmx( c, i + 1 );
+                Cmy[i] = solver.SpanLoad_Cmy( c, i + 1 );
+                Cmz[i] = solver.SpanLoad_Cmz( c, i + 1 );
+            }
+
+            // Normalized by local chord
+            double chordRatio;
+            std::vector<double> Clc_cref( num_station );
+            std::vector<double> Cdc_cref( num_station );
+            std::vector<double> Csc_cref( num_station );
+            std::vector<double> Cxc_cref( num_station );
+            std::vector<double> Cyc_cref( num_station );
+            std::vector<double> Czc_cref( num_station );
+            std::vector<double> Cmxc_cref( num_station );
+            std::vector<double> Cmyc_cref( num_station );
+            std::vector<double> Cmzc_cref( num_station );
+
+            for ( int i = 0; i < num_station; i++ )
+            {
+                chordRatio = Chord[i] / cref;
+
+                Clc_cref[i] = Cl[i] * chordRatio;
+                Cdc_cref[i] = Cd[i] * chordRatio;
+                Csc_cref[i] = Cs[i] * chordRatio;
+                Cxc_cref[i] = Cx[i] * chordRatio;
+                Cyc_cref[i] = Cy[i] * chordRatio;
+                Czc_cref[i] = Cz[i] * chordRatio;
+                Cmxc_cref[i] = Cmx[i] * chordRatio;
+                Cmyc_cref[i] = Cmy[i] * chordRatio;
+                Cmzc_cref[i] = Cmz[i] * chordRatio;
+            }
+
+            res->Add( NameValData( "WingId", WingId, "Wing ID." ) );
+            res->Add( NameValData( "S", S, "Non-dimensional spanwise coordinate." ) );
+            res->Add( NameValData( "Xavg", Xavg, "Section X coordinate." ) );
+            res->Add( NameValData( "Yavg", Yavg, "Section Y coordinate." ) );
+            res->Add( NameValData( "Zavg", Zavg, "Section Z coordinate." ) );
+            res->Add( NameValData( "Chord", Chord, "Section chord." ) );
+            res->Add( NameValData( "V/Vref", VoVref, "Local velocity ratio." ) );
+            res->Add( NameValData( "cl", Cl, "Section lift coefficient." ) );
+            res->Add( NameValData( "cd", Cd, "Section drag coefficient." ) );
+            res->Add( NameValData( "cs", Cs, "Section side force coefficient." ) );
+            res->Add( NameValData( "cx", Cx, "Section X force coefficient." ) );
+            res->Add( NameValData( "cy", Cy, "Section Y force coefficient." ) );
+            res->Add( NameValData( "cz", Cz, "Section Z force coefficient." ) );
+            res->Add( NameValData( "cmx", Cmx, "Section X moment coefficient." ) );
+            res->Add( NameValData( "cmy", Cmy, "Section Y moment coefficient." ) );
+            res->Add( NameValData( "cmz", Cmz, "Section Z moment coefficient." ) );
+
+            res->Add( NameValData( "cl*c/cref", Clc_cref, "Section lift scaled load." ) );
+            res->Add( NameValData( "cd*c/cref", Cdc_cref, "Section drag scaled load." ) );
+            res->Add( NameValData( "cs*c/cref", Csc_cref, "Section side scaled load." ) );
+            res->Add( NameValData( "cx*c/cref", Cxc_cref, "Section X scaled load." ) );
+            res->Add( NameValData( "cy*c/cref", Cyc_cref, "Section Y scaled load." ) );
+            res->Add( NameValData( "cz*c/cref", Czc_cref, "Section Z scaled load." ) );
+            res->Add( NameValData( "cmx*c/cref", Cmxc_cref, "Section X scaled moment." ) );
+            res->Add( NameValData( "cmy*c/cref", Cmyc_cref, "Section Y scaled moment." ) );
+            res->Add( NameValData( "cmz*c/cref", Cmzc_cref, "Section Z scaled moment." ) );
+
+            // Component table
+            res = ResultsMgr.CreateResults( "VSPAERO_Comp_Load", "VSPAERO component loads from lod file results." );
+            res_id_vector.push_back( res->GetID() );
+
+            int num_comp = solver.NumberOfComponents();
+
+            std::vector<int> Comp( num_comp );
+            std::vector<string> Comp_Name( num_comp );
+            std::vector<double> CompMach( num_comp, solver.Mach( c ) );
+            std::vector<double> CompAoA( num_comp, solver.AoA( c ) );
+            std::vector<double> CompBeta( num_comp, solver.Beta( c ) );
+            std::vector < std::vector<double> > CompLoad( 9, std::vector<double>( num_comp ) );
+
+            for ( int i = 0; i < num_comp; i++ )
+            {
+                Comp[i] = solver.ComponentID( i + 1 );
+                Comp_Name[i] = string( solver.ComponentName( i + 1 ) );
+
+                for ( int j = 0; j < 9; j++ )
+                {
+                    CompLoad[j][i] = solver.ComponentLoad( c, i + 1, j );
+                }
+            }
+
+            res->Add( NameValData( "Comp_ID", Comp, "Component ID." ) );
+            res->Add( NameValData( "Comp_Name", Comp_Name, "Component name." ) );
+            res->Add( NameValData( "Mach", CompMach, "Mach number." ) );
+            res->Add( NameValData( "AoA", CompAoA, "Angle of attack." ) );
+            res->Add( NameValData( "Beta", CompBeta, "Angle of sideslip." ) );
+            res->Add( NameValData( "CL", CompLoad[0], "Lift coefficient." ) );
+            res->Add( NameValData( "CDi", CompLoad[1], "Induced drag coefficient." ) );
+            res->Add( NameValData( "Cs", CompLoad[2], "Side force coefficient." ) );
+            res->Add( NameValData( "CFx", CompLoad[3], "X force coefficient." ) );
+            res->Add( NameValData( "CFy", CompLoad[4], "Y force coefficient." ) );
+            res->Add( NameValData( "CFz", CompLoad[5], "Z force coefficient." ) );
+            res->Add( NameValData( "Cmx", CompLoad[6], "X moment coefficient." ) );
+            res->Add( NameValData( "Cmy", CompLoad[7], "Y moment coefficient." ) );
+            res->Add( NameValData( "Cmz", CompLoad[8], "Z moment coefficient." ) );
+        }
+    }
+
+    vector <string> history_res_id_vector;
+    ReadHistoryFile( historyFileName, history_res_id_vector, analysisMethod, recref );
+
+    int num_history_res = ResultsMgr.GetNumResults( "VSPAERO_History" );
+
+    for ( size_t i = 0; i < recrefCases.size(); i++ )
+    {
+        const vector < double > &rc = recrefCases[i];
+        AddReCrefHistoryResults( rc[0], rc[1], rc[2], rc[3], rc[4], rc[5], rc[6], recref, num_history_res, history_res_id_vector );
+    }
+
+    res_id_vector.insert( res_id_vector.begin() + history_index, history_res_id_vector.begin(), history_res_id_vector.end() );
+#endif
+}
+
 /*******************************************************
 Read .HISTORY file output from VSPAERO
 analysisMethod is passed in because the parm it is set by might change by the time we are done calculating the solution
@@ -2491,7 +2923,6 @@ void VSPAEROMgrSingleton::ReadPolarFile( string filename, vector <string> &res_i
 
     int num_polar_col = 23; // number of columns in the file
 
-    double tol = 1e-8; // tolerance for comparing values to account for machine precision errors
     int num_history_res = ResultsMgr.GetNumResults( "VSPAERO_History" );
 
     // Read in all of the data into the results manager
@@ -2561,110 +2992,7 @@ void VSPAEROMgrSingleton::ReadPolarFile( string filename, vector <string> &res_i
                         CMn.push_back(    std::stod( data_string_array[icol] ) ); icol++;
                         Fopt.push_back(   std::stod( data_string_array[icol] ) ); icol++;
 
-                        if ( ( abs( ( 1e6 * Re_1e6.back() ) - recref ) > tol ) && num_history_res > 0 )
-                        {
-                            // Find history result with matching mach, beta, and alpha
-                            for ( size_t i = 0; i < num_history_res; i++ )
-                            {
-                                Results* history_res = ResultsMgr.FindResults( "VSPAERO_History", i );
-
-                                if ( !history_res )
-                                {
-                                    continue;
-                                }
-
-                                NameValData* mach_ptr = history_res->FindPtr( "FC_Mach_" );
-                                NameValData* alpha_ptr = history_res->FindPtr( "Alpha" );
-                                NameValData* beta_ptr = history_res->FindPtr( "FC_Beta_" );
-
-                                if ( !mach_ptr || !alpha_ptr || !beta_ptr )
-                                {
-                                    continue;
-                                }
-
-                                double mach = mach_ptr->GetDouble( 0 );
-                                double alpha = alpha_ptr->GetDouble( 0 );
-                                double beta = beta_ptr->GetDouble( 0 );
-
-                                if ( mach <= ( 0.001 + tol ) )
-                                {
-                                    // Mach is reported as 0 in the polar but 0.001 in the history file
-                                    mach = 0;
-                                }
-
-                                if ( ( abs( mach - Mach.back() ) < tol ) && ( abs( alpha - Alpha.back() ) < tol ) && ( abs( beta - Beta.back() ) < tol ) )
-                                {
-                                    // Generate new *.history results for multiple ReCref inputs since VSPAERO only outputs a result for the first ReCref
-                                    Results* new_history_res = ResultsMgr.CreateResults( "VSPAERO_History", "VSPAERO additional history results to capture ReCref variation." );
-                                    res_id_vector.push_back( new_history_res->GetID() );
-
-                                    new_history_res->Add( NameValData( "FC_ReCref_", ( 1e6 * Re_1e6.back() ), "Reynolds number." ) );
-
-                                    int num_wake = (int)alpha_ptr->GetDoubleData().size();
-
-                                    NameValData* cdo_ptr = history_res->FindPtr( "CDo" );
-                                    NameValData* cdtot_ptr = history_res->FindPtr( "CDtot" );
-                                    NameValData* l_d_ptr = history_res->FindPtr( "L/D" );
-
-                                    vector < string > data_names = history_res->GetAllDataNames();
-
-                                    // Copy ReCref dependent results from polar to history file. Copy non-dependent results from 
-                                    // history case that matches alpha, beta, and mach
-                                    for ( size_t j = 0; j < data_names.size(); j++ )
-                                    {
-                                        // Calculate wake iteration convergence differences - ReCref scales CDo, CDtot, and L_D
-                                        if ( cdo_ptr && strcmp( data_names[j].c_str(), "CDo" ) == 0 )
-                                        {
-                                            vector < double > history_cdo_vec = cdo_ptr->GetDoubleData();
-                                            vector < double > cdo_vec( num_wake, CDo.back() );
-
-                                            for ( size_t k = 0; k < history_cdo_vec.size() - 1; k++ )
-                                            {
-                                                cdo_vec[k] = cdo_vec[k] - ( history_cdo_vec.back() - history_cdo_vec[k] );
-                                            }
-
-                                            new_history_res->Add( ( NameValData( data_names[j].c_str(), cdo_vec, "Parasite drag coefficient." ) ) );
-                                        }
-                                        else if ( cdtot_ptr && strcmp( data_names[j].c_str(), "CDtot" ) == 0 )
-                                        {
-                                            vector < double > history_ctot_vec = cdtot_ptr->GetDoubleData();
-                                            vector < double > ctot_vec( num_wake, CDtot.back() );
-
-                                            for ( size_t k = 0; k < history_ctot_vec.size() - 1; k++ )
-                                            {
-                                                ctot_vec[k] = ctot_vec[k] - ( history_ctot_vec.back() - history_ctot_vec[k] );
-                                            }
-
-                                            new_history_res->Add( ( NameValData( data_names[j].c_str(), ctot_vec, "Total drag coefficient." ) ) );
-                                        }
-                                        else if ( l_d_ptr && strcmp( data_names[j].c_str(), "L/D" ) == 0 )
-                                        {
-                                            vector < double > history_l_d_vec = l_d_ptr->GetDoubleData();
-                                            vector < double > ld_vec( num_wake, L_D.back() );
-
-                                            for ( size_t k = 0; k < history_l_d_vec.size() - 1; k++ )
-                                            {
-                                                ld_vec[k] = ld_vec[k] - ( history_l_d_vec.back() - history_l_d_vec[k] );
-                                            }
-
-                                            new_history_res->Add( ( NameValData( data_names[j].c_str(), ld_vec, "Lift to drag ratio." ) ) );
-                                        }
-                                        else if ( strcmp( data_names[j].c_str(), "FC_ReCref_" ) != 0 )
-                                        {
-                                            NameValData* nvd = history_res->FindPtr( data_names[j] );
-                                            if ( !nvd )
-                                            {
-                                                continue;
-                                            }
-
-                                            new_history_res->Copy( nvd );
-                                        }
-                                    }
-
-                                    break;
-                                }
-                            }
-                        }
+                        AddReCrefHistoryResults( Beta.back(), Mach.back(), Alpha.back(), 1e6 * Re_1e6.back(), CDo.back(), CDtot.back(), L_D.back(), recref, num_history_res, res_id_vector );
 
                         data_string_array = ReadDelimLine( fp, seps );
                     }
@@ -2706,6 +3034,120 @@ void VSPAEROMgrSingleton::ReadPolarFile( string filename, vector <string> &res_i
     return;
 }
 
+/*******************************************************
+Add *.history results for each additional ReCref case, since VSPAERO only
+writes the wake iteration history for the first ReCref
+*******************************************************/
+void VSPAEROMgrSingleton::AddReCrefHistoryResults( double beta_case, double mach_case, double alpha_case, double recref_case, double cdo, double cdtot, double l_d, double recref, int num_history_res, vector <string> &res_id_vector )
+{
+    double tol = 1e-8; // tolerance for comparing values to account for machine precision errors
+
+    if ( ( abs( recref_case - recref ) > tol ) && num_history_res > 0 )
+    {
+        // Find history result with matching mach, beta, and alpha
+        for ( size_t i = 0; i < num_history_res; i++ )
+        {
+            Results* history_res = ResultsMgr.FindResults( "VSPAERO_History", i );
+
+            if ( !history_res )
+            {
+                continue;
+            }
+
+            NameValData* mach_ptr = history_res->FindPtr( "FC_Mach_" );
+            NameValData* alpha_ptr = history_res->FindPtr( "Alpha" );
+            NameValData* beta_ptr = history_res->FindPtr( "FC_Beta_" );
+
+            if ( !mach_ptr || !alpha_ptr || !beta_ptr )
+            {
+                continue;
+            }
+
+            double mach = mach_ptr->GetDouble( 0 );
+            double alpha = alpha_ptr->GetDouble( 0 );
+            double beta = beta_ptr->GetDouble( 0 );
+
+            if ( mach <= ( 0.001 + tol ) )
+            {
+                // Mach is reported as 0 in the polar but 0.001 in the history file
+                mach = 0;
+            }
+
+            if ( ( abs( mach - mach_case ) < tol ) && ( abs( alpha - alpha_case ) < tol ) && ( abs( beta - beta_case ) < tol ) )
+            {
+                // Generate new *.history results for multiple ReCref inputs since VSPAERO only outputs a result for the first ReCref
+                Results* new_history_res = ResultsMgr.CreateResults( "VSPAERO_History", "VSPAERO additional history results to capture ReCref variation." );
+                res_id_vector.push_back( new_history_res->GetID() );
+
+                new_history_res->Add( NameValData( "FC_ReCref_", recref_case, "Reynolds number." ) );
+
+                int num_wake = (int)alpha_ptr->GetDoubleData().size();
+
+                NameValData* cdo_ptr = history_res->FindPtr( "CDo" );
+                NameValData* cdtot_ptr = history_res->FindPtr( "CDtot" );
+                NameValData* l_d_ptr = history_res->FindPtr( "L/D" );
+
+                vector < string > data_names = history_res->GetAllDataNames();
+
+                // Copy ReCref dependent results from polar to history file. Copy non-dependent results from 
+                // history case that matches alpha, beta, and mach
+                for ( size_t j = 0; j < data_names.size(); j++ )
+                {
+                    // Calculate wake iteration convergence differences - ReCref scales CDo, CDtot, and L_D
+                    if ( cdo_ptr && strcmp( data_names[j].c_str(), "CDo" ) == 0 )
+                    {
+                        vector < double > history_cdo_vec = cdo_ptr->GetDoubleData();
+                        vector < double > cdo_vec( num_wake, cdo );
+
+                        for ( size_t k = 0; k < history_cdo_vec.size() - 1; k++ )
+                        {
+                            cdo_vec[k] = cdo_vec[k] - ( history_cdo_vec.back() - history_cdo_vec[k] );
+                        }
+
+                        new_history_res->Add( ( NameValData( data_names[j].c_str(), cdo_vec, "Parasite drag coefficient." ) ) );
+                    }
+                    else if ( cdtot_ptr && strcmp( data_names[j].c_str(), "CDtot" ) == 0 )
+                    {
+                        vector < double > history_ctot_vec = cdtot_ptr->GetDoubleData();
+                        vector < double > ctot_vec( num_wake, cdtot );
+
+                        for ( size_t k = 0; k < history_ctot_vec.size() - 1; k++ )
+                        {
+                            ctot_vec[k] = ctot_vec[k] - ( history_ctot_vec.back() - history_ctot_vec[k] );
+                        }
+
+                        new_history_res->Add( ( NameValData( data_names[j].c_str(), ctot_vec, "Total drag coefficient." ) ) );
+                    }
+                    else if ( l_d_ptr && strcmp( data_names[j].c_str(), "L/D" ) == 0 )
+                    {
+                        vector < double > history_l_d_vec = l_d_ptr->GetDoubleData();
+                        vector < double > ld_vec( num_wake, l_d );
+
+                        for ( size_t k = 0; k < history_l_d_vec.size() - 1; k++ )
+                        {
+                            ld_vec[k] = ld_vec[k] - ( history_l_d_vec.back() - history_l_d_vec[k] );
+                        }
+
+                        new_history_res->Add( ( NameValData( data_names[j].c_str(), ld_vec, "Lift to drag ratio." ) ) );
+                    }
+                    else if ( strcmp( data_names[j].c_str(), "FC_ReCref_" ) != 0 )
+                    {
+                        NameValData* nvd = history_res->FindPtr( data_names[j] );
+                        if ( !nvd )
+                        {
+                            continue;
+                        }
+
+                        new_history_res->Copy( nvd );
+                    }
+                }
+
+                break;
+            }
+        }
+    }
+}
+
 /*******************************************************
 Read .LOD file output from VSPAERO
 See: VSP_Solver.C in vspaero project
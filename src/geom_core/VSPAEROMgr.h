@@ -398,6 +398,7 @@ public:
     BoolParm m_ManualVrefFlag;
     IntParm m_Precondition;
     BoolParm m_KTCorrection;
+    BoolParm m_SolverLibraryFlag;
     BoolParm m_Symmetry;
     BoolParm m_Write2DFEMFlag;
     BoolParm m_AlternateInputFormatFlag;
@@ -501,9 +502,15 @@ protected:
 
     bool m_SolverProcessKill;
 
+    // in process solver, used in place of ProcessUtil when vspaero is linked in
+    bool m_SolverLibraryRunning;
+    bool CanUseSolverLibrary();
+    void ComputeSolverLibrary( string modelNameBase, string historyFileName, vector <string> &res_id_vector, vsp::VSPAERO_ANALYSIS_METHOD analysisMethod, double recref );
+
     // helper functions for VSPAERO files
     void ReadHistoryFile( string filename, vector <string> &res_id_vector, vsp::VSPAERO_ANALYSIS_METHOD analysisMethod, double recref );
     void ReadPolarFile( string filename, vector <string> &res_id_vector, double recref );
+    void AddReCrefHistoryResults( double beta_case, double mach_case, double alpha_case, double recref_case, double cdo, double cdtot, double l_d, double recref, int num_history_res, vector <string> &res_id_vector );
     void ReadLoadFile( string filename, vector <string> &res_id_vector, vsp::VSPAERO_ANALYSIS_METHOD analysisMethod );
     void ReadStabFile( string filename, vector <string> &res_id_vector, vsp::VSPAERO_ANALYSIS_METHOD analysisMethod, vsp::VSPAERO_STABILITY_TYPE stabilityType );
     static vector <string> ReadDelimLine( FILE * fp, char * delimiters );
@@ -10,6 +10,7 @@
 #define _HAS_STD_BYTE 0
 #endif
 
+#include <chrono>
 #include <filesystem>
 
 #include "Vehicle.h"
@@ -206,6 +207,8 @@ Vehicle::Vehicle()
     m_TransparentBGFlag.Init( "TransparentBGFlag", "Screenshot", this, 1, 0, 1 );
     m_AutoCropFlag.Init( "AutoCropFlag", "Screenshot", this, false, false, true );
 
+    m_BinaryMeshFlag.Init( "BinaryMeshFlag", "VSP3Settings", this, false, 0, 1 );
+
     m_UserParmVal.Init( "Val", "UserParm", this, 0.0, -1.0e12, 1.0e12 );
     m_UserParmMin.Init( "Min", "UserParm", this, -1.0e5, -1.0e12, 1.0e12 );
     m_UserParmMax.Init( "Max", "UserParm", this, 1.0e5, -1.0e12, 1.0e12 );
@@ -230,6 +233,16 @@ Vehicle::Vehicle()
     m_STLExportPropMainSurf.Init( "ExportPropMainSurf", "STLSettings", this, false, 0, 1 );
 
     m_UpdatingBBox = false;
+    m_UpdateClosureActive = false;
+    m_DeferTessActive = false;
+    m_LastUpdateClosureTime = 0.0;
+    m_LastUpdateGeomTime = 0.0;
+    m_LastUpdateTessTime = 0.0;
+    m_UpdateCacheSize = 0;
+    m_UpdateCacheHits = 0;
+    m_UpdateCacheMisses = 0;
+    m_LastUpdateMgrTime = 0.0;
+    m_LastUpdateNumGeoms = 0;
     m_BbXLen.Init( "X_Len", "BBox", this, 0, 0, 1e12 );
     m_BbXLen.SetDescript( "X length of vehicle bounding box" );
     m_BbYLen.Init( "Y_Len", "BBox", this, 0, 0, 1e12 );
@@ -441,6 +454,8 @@ void Vehicle::Init()
     m_TransparentBGFlag.Set( 1 );
     m_AutoCropFlag.Set( false );
 
+    m_BinaryMeshFlag.Set( false );
+
     m_STLMultiSolid.Set( false );
     m_STLExportPropMainSurf.Set( false );
 
@@ -506,6 +521,8 @@ void Vehicle::Wype()
     }
 
     m_GeomStoreVec.clear();
+    m_GeomStoreMap.clear();
+    m_DeferredTessVec.clear();
 
     m_ActiveGeom.clear();
     m_TopGeom.clear();
@@ -718,17 +735,121 @@ void Vehicle::UnDo()
 //===== Update All Geometry ====//
 void Vehicle::Update( bool fullupdate )
 {
+    auto t0 = std::chrono::steady_clock::now();
+
+    m_LastUpdateNumGeoms = 0;
+
+    MarkUpdateClosure();
+
+    auto t1 = std::chrono::steady_clock::now();
+
+    //==== Only Visit Geoms That Need Update Or Have A Descendant That Does ====//
+    bool active_flag = m_UpdateClosureActive;
+    m_UpdateClosureActive = true;
+
+    // Surfaces update serially in parent-before-child order, tessellation is queued.
+    bool defer_flag = m_DeferTessActive;
+    m_DeferTessActive = true;
+
     for ( int i = 0 ; i < ( int )m_TopGeom.size() ; i++ )
     {
         Geom* g_ptr = FindGeom( m_TopGeom[i] );
-        if ( g_ptr )
+        if ( g_ptr && ( g_ptr->m_UpdateClosureFlag || g_ptr->UpdateNeeded() ) )
         {
             g_ptr->Update( fullupdate );
         }
     }
 
+    m_UpdateClosureActive = active_flag;
+    m_DeferTessActive = defer_flag;
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    // Only the outermost update flushes the queue.
+    if ( !m_DeferTessActive )
+    {
+        UpdateDeferredTess();
+    }
+
+    auto t3 = std::chrono::steady_clock::now();
+
     MeasureMgr.Update();
     Background3DMgr.Update();
+
+    auto t4 = std::chrono::steady_clock::now();
+
+    m_LastUpdateClosureTime = std::chrono::duration< double >( t1 - t0 ).count();
+    m_LastUpdateGeomTime = std::chrono::duration< double >( t2 - t1 ).count();
+    m_LastUpdateTessTime = std::chrono::duration< double >( t3 - t2 ).count();
+    m_LastUpdateMgrTime = std::chrono::duration< double >( t4 - t3 ).count();
+}
+
+//==== Set Number Of Update Cache Entries Kept By Each Geom ====//
+void Vehicle::SetUpdateCacheSize( int size )
+{
+    m_UpdateCacheSize = max( size, 0 );
+
+    for ( int i = 0 ; i < ( int )m_GeomStoreVec.size() ; i++ )
+    {
+        m_GeomStoreVec[i]->ClearUpdateCache();
+    }
+
+    ResetUpdateCacheStats();
+}
+
+//==== Queue Geom Tessellation Until The End Of Vehicle::Update ====//
+bool Vehicle::DeferTess( Geom* gPtr )
+{
+    if ( !m_DeferTessActive )
+    {
+        return false;
+    }
+
+    // A Geom may be updated more than once per vehicle update, queue it once.
+    if ( !vector_contains_val( m_DeferredTessVec, gPtr ) )
+    {
+        m_DeferredTessVec.push_back( gPtr );
+    }
+    return true;
+}
+
+//==== Tessellate Queued Geoms In Parallel, Then Update DrawObjs On This Thread ====//
+void Vehicle::UpdateDeferredTess()
+{
+    #pragma omp parallel for schedule( dynamic )
+    for ( int i = 0 ; i < ( int )m_DeferredTessVec.size() ; i++ )
+    {
+        m_DeferredTessVec[i]->UpdateDeferredTess();
+    }
+
+    for ( int i = 0 ; i < ( int )m_DeferredTessVec.size() ; i++ )
+    {
+        m_DeferredTessVec[i]->UpdateDeferredDrawObj();
+    }
+
+    m_DeferredTessVec.clear();
+}
+
+//==== Flag Geoms That Need Update And All Their Ancestors ====//
+void Vehicle::MarkUpdateClosure()
+{
+    for ( int i = 0 ; i < ( int )m_GeomStoreVec.size() ; i++ )
+    {
+        m_GeomStoreVec[i]->m_UpdateClosureFlag = false;
+    }
+
+    for ( int i = 0 ; i < ( int )m_GeomStoreVec.size() ; i++ )
+    {
+        if ( m_GeomStoreVec[i]->UpdateNeeded() )
+        {
+            Geom* g_ptr = m_GeomStoreVec[i];
+            while ( g_ptr && !g_ptr->m_UpdateClosureFlag )
+            {
+                g_ptr->m_UpdateClosureFlag = true;
+                g_ptr = FindGeom( g_ptr->GetParentID() );
+            }
+        }
+    }
 }
 
 // Update managers that are normally only updated by their
@@ -782,16 +903,52 @@ Geom* Vehicle::FindGeom( const string & geom_id )
     {
         return NULL;
     }
+
+    //==== Geom IDs Can Change After Creation (XML ID Remap), So Verify Hits ====//
+    unordered_map< string, Geom* >::const_iterator iter = m_GeomStoreMap.find( geom_id );
+    if ( iter != m_GeomStoreMap.end() && iter->second->IsMatch( geom_id ) )
+    {
+        return iter->second;
+    }
+
     for ( int i = 0 ; i < ( int )m_GeomStoreVec.size() ; i++ )
     {
         if ( m_GeomStoreVec[i]->IsMatch( geom_id ) )
         {
+            m_GeomStoreMap[ geom_id ] = m_GeomStoreVec[i];
             return m_GeomStoreVec[i];
         }
     }
     return NULL;
 }
 
+//==== Add Geom To Storage ====//
+void Vehicle::AddGeomToStore( Geom* gPtr )
+{
+    m_GeomStoreVec.push_back( gPtr );
+    m_GeomStoreMap[ gPtr->GetID() ] = gPtr;
+}
+
+//==== Remove Geom From Storage (Does Not Delete) ====//
+void Vehicle::RemoveGeomFromStore( Geom* gPtr )
+{
+    vector_remove_val( m_GeomStoreVec, gPtr );
+    vector_remove_val( m_DeferredTessVec, gPtr );
+
+    unordered_map< string, Geom* >::iterator iter = m_GeomStoreMap.begin();
+    while ( iter != m_GeomStoreMap.end() )
+    {
+        if ( iter->second == gPtr )
+        {
+            iter = m_GeomStoreMap.erase( iter );
+        }
+        else
+        {
+            ++iter;
+        }
+    }
+}
+
 //==== Find Vector of Geom Ptrs Based on GeomID ====//
 vector< Geom* > Vehicle::FindGeomVec( const vector< string > & geom_id_vec )
 {
@@ -880,7 +1037,7 @@ string Vehicle::CreateGeom( const GeomType & type )
         return "NONE";
     }
 
-    m_GeomStoreVec.push_back( new_geom );
+    AddGeomToStore( new_geom );
 
     Geom* type_geom_ptr = FindGeom( type.m_GeomID );
     if ( type_geom_ptr )
@@ -1356,7 +1513,7 @@ void Vehicle::DeleteClipBoard()
         Geom* gPtr = FindGeom( m_ClipBoard[i] );
         if ( gPtr )
         {
-            vector_remove_val( m_GeomStoreVec, gPtr );
+            RemoveGeomFromStore( gPtr );
             delete gPtr;
         }
     }
@@ -1368,7 +1525,7 @@ void Vehicle::DeleteGeom( const string & geom_id )
     Geom* gPtr = FindGeom( geom_id );
     if ( gPtr )
     {
-        vector_remove_val( m_GeomStoreVec, gPtr );
+        RemoveGeomFromStore( gPtr );
         vector_remove_val( m_ActiveGeom, geom_id );
         delete gPtr;
     }
@@ -1788,7 +1945,7 @@ void Vehicle::DeleteType( int index )
     Geom* gPtr = FindGeom( type.m_GeomID );
     if ( gPtr )
     {
-        vector_remove_val( m_GeomStoreVec, gPtr );
+        RemoveGeomFromStore( gPtr );
         delete gPtr;
     }
 
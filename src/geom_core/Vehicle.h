@@ -36,6 +36,7 @@
 #include <deque>
 #include <stack>
 #include <memory>
+#include <unordered_map>
 
 // File versions must be integers.
 #define MIN_FILE_VER 4 // Lowest file version number for 3.X vsp file
@@ -71,6 +72,29 @@ public:
     void UpdateGeom( const string &geom_id );
     void ForceUpdate( int dirtyflag = GeomBase::NONE );
     static void UpdateGUI();
+
+    //==== Incremental Update - Only Geoms That Need Update And Their Ancestors Are Visited ====//
+    bool IsUpdateClosureActive()                                     { return m_UpdateClosureActive; }
+
+    //==== Queue Geom Tessellation For Parallel Update - Returns False If Not Deferring ====//
+    bool DeferTess( Geom* gPtr );
+    void UpdateDeferredTess();
+    void CountGeomUpdate()                                           { m_LastUpdateNumGeoms++; }
+
+    //==== Stage Times (sec) And Number Of Geoms Updated By Last Update ====//
+    double GetLastUpdateClosureTime()                                { return m_LastUpdateClosureTime; }
+    double GetLastUpdateGeomTime()                                   { return m_LastUpdateGeomTime; }
+    double GetLastUpdateTessTime()                                   { return m_LastUpdateTessTime; }
+    double GetLastUpdateMgrTime()                                    { return m_LastUpdateMgrTime; }
+    int GetLastUpdateNumGeoms()                                      { return m_LastUpdateNumGeoms; }
+
+    //==== Per Geom Update Cache - Size Is Entries Per Geom, Zero Disables ====//
+    void SetUpdateCacheSize( int size );
+    int GetUpdateCacheSize()                                         { return m_UpdateCacheSize; }
+    void CountUpdateCache( bool hit )                                { hit ? m_UpdateCacheHits++ : m_UpdateCacheMisses++; }
+    int GetUpdateCacheHits()                                         { return m_UpdateCacheHits; }
+    int GetUpdateCacheMisses()                                       { return m_UpdateCacheMisses; }
+    void ResetUpdateCacheStats()                                     { m_UpdateCacheHits = 0; m_UpdateCacheMisses = 0; }
     static int RunScript( const string & file_name, const string & function_name = "main" );
 
     Geom* FindGeom( const string & geom_id );
@@ -114,6 +138,7 @@ public:
     void SetNumUserSets( int nuset );
     void SetSetName( int index, const string& name );
     vector< string > GetSetNameVec( bool includeNone = false );
+    int GetNumSets()                                                 { return ( int )m_SetNameVec.size(); }
     void ShowOnlySet( int index );
     void NoShowSet( int index );
     void ShowSet( int index );
@@ -462,6 +487,9 @@ public:
     BoolParm m_TransparentBGFlag;
     BoolParm m_AutoCropFlag;
 
+    // Store MeshGeom and PtCloudGeom data as base64 arrays in .vsp3 files
+    BoolParm m_BinaryMeshFlag;
+
     // UserParmScreen
     Parm m_UserParmVal;
     Parm m_UserParmMin;
@@ -510,6 +538,24 @@ protected:
     virtual void SetExportPropMainSurf( bool b );
 
     vector< Geom* > m_GeomStoreVec;                 // All Geom Ptrs
+    unordered_map< string, Geom* > m_GeomStoreMap;  // ID -> Geom Ptr, Verified On Lookup
+
+    void AddGeomToStore( Geom* gPtr );
+    void RemoveGeomFromStore( Geom* gPtr );
+    void MarkUpdateClosure();
+
+    bool m_UpdateClosureActive;
+    bool m_DeferTessActive;
+    vector< Geom* > m_DeferredTessVec;
+    double m_LastUpdateClosureTime;
+    double m_LastUpdateGeomTime;
+    double m_LastUpdateTessTime;
+    double m_LastUpdateMgrTime;
+    int m_LastUpdateNumGeoms;
+
+    int m_UpdateCacheSize;
+    int m_UpdateCacheHits;
+    int m_UpdateCacheMisses;
 
     vector< DegenGeom > m_DegenGeomVec;         // Vector of components in degenerate representation
     vector< DegenPtMass > m_DegenPtMassVec;
@@ -2131,7 +2131,11 @@ void WingGeom::UpdateSurf()
 
     u_vec.push_back( nxsec - 1 );
 
-    m_MainSurfVec[0].SkinRibs( ref_rib_vec, u_vec, false );
+    if ( !RestoreCachedSkin( 0, m_MainSurfVec[0] ) )
+    {
+        m_MainSurfVec[0].SkinRibs( ref_rib_vec, u_vec, false );
+        StoreCachedSkin( 0, m_MainSurfVec[0] );
+    }
 
     for ( int i = 0 ; i < nxsec ; i++ )
     {
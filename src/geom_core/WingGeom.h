@@ -155,6 +155,8 @@ public:
     WingGeom( Vehicle* vehicle_ptr );
     virtual ~WingGeom();
 
+    virtual bool IsUpdateCacheable()                { return true; }
+
     virtual void Update( bool fullupdate = true );
 
     virtual void ComputeCenter();
@@ -2956,6 +2956,17 @@ bool FileXSec::ReadXSecFile( FILE* file_id )
     return true;
 }
 
+//==== File Points Are Not Parms ====//
+void FileXSec::HashNonParmState( std::size_t & seed ) const
+{
+    for ( int i = 0 ; i < ( int )m_UnityFilePnts.size() ; i++ )
+    {
+        hash_combine( seed, m_UnityFilePnts[i].x() );
+        hash_combine( seed, m_UnityFilePnts[i].y() );
+        hash_combine( seed, m_UnityFilePnts[i].z() );
+    }
+}
+
 //==== Set Pnt Vec ====//
 void FileXSec::SetPnts( vector< vec3d > & pnt_vec )
 {
@@ -491,6 +491,8 @@ public:
     bool ReadXsecFile( string file_name );
     void SetPnts( vector< vec3d > & pnt_vec );
 
+    virtual void HashNonParmState( std::size_t & seed ) const;
+
     virtual void ReadV2FileFuse2( xmlNodePtr &root );
 
     Parm m_Width;
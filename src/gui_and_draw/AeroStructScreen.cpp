@@ -687,6 +687,19 @@ void * aerostruct_feamesh_thread_fun( void *data )
 
 void AeroStructScreen::LaunchBatchFEAMesh( const vector < string > &idvec )
 {
+    // Assemblies may mesh their structures concurrently, single structures never do.
+    bool concurrent_flag = false;
+    if ( AeroStructMgr.m_CurrStructAssyIndex() >= 0 && !AeroStructMgr.m_StructAssyFlagVec[ AeroStructMgr.m_CurrStructAssyIndex() ] )
+    {
+        FeaAssembly *fea_assy = StructureMgr.GetFeaAssembly( AeroStructMgr.m_StructAssyIDVec[ AeroStructMgr.m_CurrStructAssyIndex() ] );
+
+        if ( fea_assy )
+        {
+            concurrent_flag = fea_assy->m_AssemblySettings.m_ConcurrentMeshFlag();
+        }
+    }
+    FeaMeshMgr.SetConcurrentMeshFlag( concurrent_flag );
+
     // Set m_FeaMeshInProgress to ensure m_MonitorProcess does not terminate prematurely
     FeaMeshMgr.SetFeaMeshInProgress( true );
 
@@ -74,13 +74,15 @@ StructAssemblyScreen::StructAssemblyScreen( ScreenMgr* mgr ) : TabScreen( mgr, 4
 
     m_BorderConsoleLayout.AddYGap();
 
-    m_BorderConsoleLayout.AddButton( m_DrawAsMeshButton, "Draw as Mesh When Ready" );
-
     m_BorderConsoleLayout.SetSameLineFlag( true );
     m_BorderConsoleLayout.SetFitWidthFlag( false );
 
     m_BorderConsoleLayout.SetButtonWidth( m_BorderConsoleLayout.GetW() / 2 );
 
+    m_BorderConsoleLayout.AddButton( m_DrawAsMeshButton, "Draw as Mesh When Ready" );
+    m_BorderConsoleLayout.AddButton( m_ConcurrentMeshButton, "Mesh Concurrently" );
+    m_BorderConsoleLayout.ForceNewLine();
+
 
     m_BorderConsoleLayout.AddButton( m_FeaReMeshAllButton, "Re-Mesh All" );
     m_BorderConsoleLayout.AddButton( m_FeaMeshUnmeshedButton, "Mesh Unmeshed" );
@@ -373,6 +375,7 @@ bool StructAssemblyScreen::Update()
     }
 
     m_DrawAsMeshButton.Update( curr_assy->m_AssemblySettings.m_DrawAsMeshFlag.GetID() );
+    m_ConcurrentMeshButton.Update( curr_assy->m_AssemblySettings.m_ConcurrentMeshFlag.GetID() );
 
     //===== Display Tab Toggle Update =====//
     m_DrawMeshButton.Update( curr_assy->m_AssemblySettings.m_DrawMeshFlag.GetID() );
@@ -829,6 +832,7 @@ void StructAssemblyScreen::GuiDeviceCallBack( GuiDevice* device )
         if ( curr_assy )
         {
             FeaMeshMgr.CleanupMeshes( curr_assy->m_StructIDVec );
+            FeaMeshMgr.SetConcurrentMeshFlag( curr_assy->m_AssemblySettings.m_ConcurrentMeshFlag() );
             LaunchBatchFEAMesh( curr_assy->m_StructIDVec );
         }
     }
@@ -836,6 +840,7 @@ void StructAssemblyScreen::GuiDeviceCallBack( GuiDevice* device )
     {
         if ( curr_assy )
         {
+            FeaMeshMgr.SetConcurrentMeshFlag( curr_assy->m_AssemblySettings.m_ConcurrentMeshFlag() );
             LaunchBatchFEAMesh( curr_assy->m_StructIDVec );
         }
     }
@@ -155,6 +155,7 @@ private:
     StringOutput m_CalcOutput;
 
     ToggleButton m_DrawAsMeshButton;
+    ToggleButton m_ConcurrentMeshButton;
 
     ToggleButton m_DrawMeshButton;
     ToggleButton m_ColorElementsButton;
@@ -1772,6 +1772,8 @@ StructScreen::StructScreen( ScreenMgr* mgr ) : TabScreen( mgr, 550, 750, "FEA St
     m_MeshTabLayout.AddYGap();
     m_MeshTabLayout.AddButton( m_ToCubicToggle, "Demote Surfs to Cubic" );
     m_MeshTabLayout.AddSlider( m_ToCubicTolSlider, "Cubic Tolerance", 10, "%5.4g", 0, true );
+    m_MeshTabLayout.AddYGap();
+    m_MeshTabLayout.AddButton( m_IncrementalRemeshToggle, "Reuse Unchanged Surface Meshes" );
 
     m_MeshTabLayout.AddYGap();
     m_MeshTabLayout.AddDividerBox( "Element Type" );
@@ -3642,6 +3644,8 @@ bool StructScreen::Update()
                 m_ToCubicTolSlider.Deactivate();
             }
 
+            m_IncrementalRemeshToggle.Update( curr_struct->GetStructSettingsPtr()->m_IncrementalRemeshFlag.GetID() );
+
             m_ConvertToQuadsToggle.Update( curr_struct->GetStructSettingsPtr()->m_ConvertToQuadsFlag.GetID() );
             m_HighOrderElementToggle.Update( curr_struct->GetStructSettingsPtr()->m_HighOrderElementFlag.GetID() );
 
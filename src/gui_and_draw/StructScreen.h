@@ -501,6 +501,7 @@ private:
     ToggleButton m_HalfMeshButton;
     ToggleButton m_ToCubicToggle;
     SliderAdjRangeInput m_ToCubicTolSlider;
+    ToggleButton m_IncrementalRemeshToggle;
 
     ToggleButton m_ConvertToQuadsToggle;
     ToggleButton m_HighOrderElementToggle;
@@ -0,0 +1,277 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// Bounding Volume Hierarchy of BndBoxes  BndBoxTree.cpp:
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "BndBoxTree.h"
+
+#include <algorithm>
+
+// Maximum number of boxes stored in a leaf node
+static const int BNDBOXTREE_LEAF_SIZE = 4;
+
+//===== Constructor =====//
+BndBoxTree::BndBoxTree()
+{
+}
+
+//===== Destructor =====//
+BndBoxTree::~BndBoxTree()
+{
+}
+
+void BndBoxTree::Clear()
+{
+    m_BoxVec.clear();
+    m_IndexVec.clear();
+    m_NodeVec.clear();
+}
+
+//===== Build Tree Top Down By Median Split Along Largest Axis of Box Centers =====//
+void BndBoxTree::Build( const vector< BndBox > & box_vec )
+{
+    Clear();
+
+    m_BoxVec = box_vec;
+
+    m_IndexVec.resize( m_BoxVec.size() );
+    for ( int i = 0 ; i < ( int )m_IndexVec.size() ; i++ )
+    {
+        m_IndexVec[i] = i;
+    }
+
+    if ( !m_BoxVec.empty() )
+    {
+        m_NodeVec.reserve( 2 * m_BoxVec.size() / BNDBOXTREE_LEAF_SIZE + 1 );
+        BuildNode( 0, ( int )m_IndexVec.size() );
+    }
+}
+
+int BndBoxTree::BuildNode( int begin, int end )
+{
+    int n = ( int )m_NodeVec.size();
+    m_NodeVec.push_back( Node() );
+
+    BndBox box;
+    BndBox center_box;
+    for ( int i = begin ; i < end ; i++ )
+    {
+        box.Update( m_BoxVec[ m_IndexVec[i] ] );
+        center_box.Update( m_BoxVec[ m_IndexVec[i] ].GetCenter() );
+    }
+
+    m_NodeVec[n].m_Box = box;
+    m_NodeVec[n].m_Begin = begin;
+    m_NodeVec[n].m_End = end;
+    m_NodeVec[n].m_Child[0] = -1;
+    m_NodeVec[n].m_Child[1] = -1;
+
+    if ( end - begin <= BNDBOXTREE_LEAF_SIZE )
+    {
+        return n;
+    }
+
+    //==== Split Along Axis With Largest Spread Of Centers ====//
+    int axis = 0;
+    double len = center_box.GetMax( 0 ) - center_box.GetMin( 0 );
+    for ( int i = 1 ; i < 3 ; i++ )
+    {
+        double l = center_box.GetMax( i ) - center_box.GetMin( i );
+        if ( l > len )
+        {
+            len = l;
+            axis = i;
+        }
+    }
+
+    int mid = ( begin + end ) / 2;
+    const vector< BndBox > & boxes = m_BoxVec;
+    nth_element( m_IndexVec.begin() + begin, m_IndexVec.begin() + mid, m_IndexVec.begin() + end,
+                 [ &boxes, axis ]( int a, int b )
+                 {
+                     return boxes[a].GetCenter()[axis] < boxes[b].GetCenter()[axis];
+                 } );
+
+    // BuildNode may reallocate m_NodeVec, so do not hold references across these calls.
+    int c0 = BuildNode( begin, mid );
+    int c1 = BuildNode( mid, end );
+
+    m_NodeVec[n].m_Child[0] = c0;
+    m_NodeVec[n].m_Child[1] = c1;
+
+    return n;
+}
+
+void BndBoxTree::FindOverlaps( vector< pair< int, int > > & pair_vec, double tol ) const
+{
+    if ( m_NodeVec.empty() )
+    {
+        return;
+    }
+    SelfOverlaps( 0, pair_vec, tol );
+}
+
+void BndBoxTree::FindOverlaps( const BndBoxTree & other, vector< pair< int, int > > & pair_vec, double tol ) const
+{
+    if ( m_NodeVec.empty() || other.m_NodeVec.empty() )
+    {
+        return;
+    }
+    CrossOverlaps( 0, other, 0, false, pair_vec, tol );
+}
+
+void BndBoxTree::SelfOverlaps( int n, vector< pair< int, int > > & pair_vec, double tol ) const
+{
+    const Node & node = m_NodeVec[n];
+
+    if ( node.IsLeaf() )
+    {
+        for ( int i = node.m_Begin ; i < node.m_End ; i++ )
+        {
+            for ( int j = i + 1 ; j < node.m_End ; j++ )
+            {
+                int a = m_IndexVec[i];
+                int b = m_IndexVec[j];
+                if ( Compare( m_BoxVec[a], m_BoxVec[b], tol ) )
+                {
+                    pair_vec.push_back( make_pair( min( a, b ), max( a, b ) ) );
+                }
+            }
+        }
+        return;
+    }
+
+    SelfOverlaps( node.m_Child[0], pair_vec, tol );
+    SelfOverlaps( node.m_Child[1], pair_vec, tol );
+    CrossOverlaps( node.m_Child[0], *this, node.m_Child[1], true, pair_vec, tol );
+}
+
+void BndBoxTree::CrossOverlaps( int na, const BndBoxTree & tb, int nb, bool self, vector< pair< int, int > > & pair_vec, double tol ) const
+{
+    const Node & node_a = m_NodeVec[na];
+    const Node & node_b = tb.m_NodeVec[nb];
+
+    if ( !Compare( node_a.m_Box, node_b.m_Box, tol ) )
+    {
+        return;
+    }
+
+    if ( node_a.IsLeaf() && node_b.IsLeaf() )
+    {
+        for ( int i = node_a.m_Begin ; i < node_a.m_End ; i++ )
+        {
+            int a = m_IndexVec[i];
+            for ( int j = node_b.m_Begin ; j < node_b.m_End ; j++ )
+            {
+                int b = tb.m_IndexVec[j];
+                if ( Compare( m_BoxVec[a], tb.m_BoxVec[b], tol ) )
+                {
+                    if ( self )
+                    {
+                        pair_vec.push_back( make_pair( min( a, b ), max( a, b ) ) );
+                    }
+                    else
+                    {
+                        pair_vec.push_back( make_pair( a, b ) );
+                    }
+                }
+            }
+        }
+        return;
+    }
+
+    //==== Descend Into The Larger Node (Or The Only Non-Leaf) ====//
+    bool split_a = node_b.IsLeaf() ||
+                   ( !node_a.IsLeaf() && node_a.m_End - node_a.m_Begin >= node_b.m_End - node_b.m_Begin );
+
+    if ( split_a )
+    {
+        CrossOverlaps( node_a.m_Child[0], tb, nb, self, pair_vec, tol );
+        CrossOverlaps( node_a.m_Child[1], tb, nb, self, pair_vec, tol );
+    }
+    else
+    {
+        CrossOverlaps( na, tb, node_b.m_Child[0], self, pair_vec, tol );
+        CrossOverlaps( na, tb, node_b.m_Child[1], self, pair_vec, tol );
+    }
+}
+
+void BndBoxTree::FindOverlaps( const BndBox & box, vector< int > & id_vec, double tol ) const
+{
+    if ( m_NodeVec.empty() )
+    {
+        return;
+    }
+
+    vector< int > stack;
+    stack.push_back( 0 );
+
+    while ( !stack.empty() )
+    {
+        const Node & node = m_NodeVec[ stack.back() ];
+        stack.pop_back();
+
+        if ( !Compare( node.m_Box, box, tol ) )
+        {
+            continue;
+        }
+
+        if ( node.IsLeaf() )
+        {
+            for ( int i = node.m_Begin ; i < node.m_End ; i++ )
+            {
+                if ( Compare( m_BoxVec[ m_IndexVec[i] ], box, tol ) )
+                {
+                    id_vec.push_back( m_IndexVec[i] );
+                }
+            }
+        }
+        else
+        {
+            stack.push_back( node.m_Child[1] );
+            stack.push_back( node.m_Child[0] );
+        }
+    }
+}
+
+void BndBoxTree::FindContaining( const vec3d & pnt, vector< int > & id_vec ) const
+{
+    if ( m_NodeVec.empty() )
+    {
+        return;
+    }
+
+    vector< int > stack;
+    stack.push_back( 0 );
+
+    while ( !stack.empty() )
+    {
+        const Node & node = m_NodeVec[ stack.back() ];
+        stack.pop_back();
+
+        if ( !node.m_Box.CheckPnt( pnt ) )
+        {
+            continue;
+        }
+
+        if ( node.IsLeaf() )
+        {
+            for ( int i = node.m_Begin ; i < node.m_End ; i++ )
+            {
+                if ( m_BoxVec[ m_IndexVec[i] ].CheckPnt( pnt ) )
+                {
+                    id_vec.push_back( m_IndexVec[i] );
+                }
+            }
+        }
+        else
+        {
+            stack.push_back( node.m_Child[1] );
+            stack.push_back( node.m_Child[0] );
+        }
+    }
+}
@@ -0,0 +1,77 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// Bounding Volume Hierarchy of BndBoxes  BndBoxTree.h:
+//
+//   Binary tree of axis aligned boxes used to find overlapping pairs without
+//   testing every combination.  Boxes are identified by their index in the
+//   vector passed to Build().
+//
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(BNDBOXTREE__INCLUDED_)
+#define BNDBOXTREE__INCLUDED_
+
+#include "BndBox.h"
+
+#include <vector>
+#include <utility>
+using namespace std;
+
+class BndBoxTree
+{
+public:
+
+    BndBoxTree();
+    virtual ~BndBoxTree();
+
+    void Clear();
+    void Build( const vector< BndBox > & box_vec );
+
+    int GetNumBoxes() const
+    {
+        return ( int )m_BoxVec.size();
+    }
+
+    //==== All Pairs Of Overlapping Boxes In This Tree (first < second) ====//
+    void FindOverlaps( vector< pair< int, int > > & pair_vec, double tol = 1.0e-12 ) const;
+
+    //==== All Pairs Of Overlapping Boxes Between This Tree (first) And Other (second) ====//
+    void FindOverlaps( const BndBoxTree & other, vector< pair< int, int > > & pair_vec, double tol = 1.0e-12 ) const;
+
+    //==== All Boxes That Overlap Box ====//
+    void FindOverlaps( const BndBox & box, vector< int > & id_vec, double tol = 1.0e-12 ) const;
+
+    //==== All Boxes That Contain Pnt ====//
+    void FindContaining( const vec3d & pnt, vector< int > & id_vec ) const;
+
+protected:
+
+    class Node
+    {
+    public:
+        BndBox m_Box;
+        int m_Child[2];         // -1 for leaf nodes
+        int m_Begin;            // Range into m_IndexVec
+        int m_End;
+
+        bool IsLeaf() const
+        {
+            return m_Child[0] < 0;
+        }
+    };
+
+    int BuildNode( int begin, int end );
+
+    void SelfOverlaps( int n, vector< pair< int, int > > & pair_vec, double tol ) const;
+    void CrossOverlaps( int na, const BndBoxTree & tb, int nb, bool self, vector< pair< int, int > > & pair_vec, double tol ) const;
+
+    vector< BndBox > m_BoxVec;
+    vector< int > m_IndexVec;
+    vector< Node > m_NodeVec;
+
+};
+
+#endif
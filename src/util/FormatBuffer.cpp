@@ -0,0 +1,199 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// Text output buffer with fast number formatting  FormatBuffer.cpp:
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "FormatBuffer.h"
+#include "StringUtil.h"
+
+#include <cmath>
+#include <cstdarg>
+
+// Powers of ten exactly representable as doubles
+static const double FORMATBUFFER_POW10[] = { 1.0e0, 1.0e1, 1.0e2, 1.0e3, 1.0e4, 1.0e5, 1.0e6, 1.0e7,
+                                             1.0e8, 1.0e9, 1.0e10, 1.0e11, 1.0e12, 1.0e13, 1.0e14, 1.0e15 };
+static const int FORMATBUFFER_MAX_PREC = 15;
+
+//===== Constructor =====//
+FormatBuffer::FormatBuffer()
+{
+}
+
+//===== Destructor =====//
+FormatBuffer::~FormatBuffer()
+{
+}
+
+void FormatBuffer::Append( const char* str )
+{
+    m_Buf.append( str );
+}
+
+//==== Right Justify In Field Width ====//
+void FormatBuffer::AppendPad( const char* str, int len, int width )
+{
+    if ( width > len )
+    {
+        m_Buf.append( width - len, ' ' );
+    }
+    m_Buf.append( str, len );
+}
+
+void FormatBuffer::AppendInt( long long int v, int width )
+{
+    char tmp[32];
+    char* end = tmp + sizeof( tmp );
+    char* p = end;
+
+    // Negate as unsigned so LLONG_MIN does not overflow
+    unsigned long long int u = v < 0 ? 0ULL - ( unsigned long long int ) v : ( unsigned long long int ) v;
+
+    do
+    {
+        *--p = ( char ) ( '0' + u % 10 );
+        u /= 10;
+    }
+    while ( u > 0 );
+
+    if ( v < 0 )
+    {
+        *--p = '-';
+    }
+
+    AppendPad( p, ( int ) ( end - p ), width );
+}
+
+void FormatBuffer::AppendFixed( double v, int prec, int width )
+{
+    if ( prec >= 0 && prec <= FORMATBUFFER_MAX_PREC && std::isfinite( v ) )
+    {
+        double scaled = std::abs( v ) * FORMATBUFFER_POW10[ prec ];
+
+        if ( scaled < 9.0e15 )
+        {
+            double whole = std::floor( scaled );
+            double frac = scaled - whole;
+
+            // scaled carries at most half an ulp of error.  Values that land
+            // that close to a rounding tie are left to printf, which rounds
+            // the exact binary value.
+            if ( std::abs( frac - 0.5 ) > scaled * 4.0e-16 )
+            {
+                unsigned long long int u = ( unsigned long long int ) whole;
+                if ( frac > 0.5 )
+                {
+                    u++;
+                }
+
+                char tmp[48];
+                char* end = tmp + sizeof( tmp );
+                char* p = end;
+
+                for ( int i = 0; i < prec; i++ )
+                {
+                    *--p = ( char ) ( '0' + u % 10 );
+                    u /= 10;
+                }
+                if ( prec > 0 )
+                {
+                    *--p = '.';
+                }
+
+                do
+                {
+                    *--p = ( char ) ( '0' + u % 10 );
+                    u /= 10;
+                }
+                while ( u > 0 );
+
+                // printf keeps the sign of negative values that round to zero
+                if ( std::signbit( v ) )
+                {
+                    *--p = '-';
+                }
+
+                AppendPad( p, ( int ) ( end - p ), width );
+                return;
+            }
+        }
+    }
+
+    AppendFormat( "%*.*f", width, prec, v );
+}
+
+void FormatBuffer::AppendNas( double v )
+{
+    // Mirrors the branches of StringUtil::NasFmt()
+    double input = v + 0.0;
+    double ainput = std::abs( input );
+
+    int prec = 5;
+    double limit = 1.0e6;
+    if ( input > 0 )
+    {
+        prec = 6;
+        limit = 1.0e7;
+    }
+
+    if ( ainput >= 0.001 && ainput < limit )
+    {
+        for ( double dec = 10.0; ainput >= dec; dec *= 10.0 )
+        {
+            prec--;
+        }
+
+        if ( prec == 0 )
+        {
+            AppendFixed( v, 0, 7 ); // Shrink and pad with decimal
+            Append( '.' );
+        }
+        else
+        {
+            AppendFixed( v, prec, 8 );
+        }
+        return;
+    }
+
+    // Scientific notation
+    AppendFormat( StringUtil::NasFmt( v ).c_str(), v );
+}
+
+void FormatBuffer::AppendFormat( const char* fmt, ... )
+{
+    char tmp[256];
+
+    va_list args;
+    va_start( args, fmt );
+    va_list args_copy;
+    va_copy( args_copy, args );
+
+    int n = vsnprintf( tmp, sizeof( tmp ), fmt, args );
+
+    if ( n >= ( int ) sizeof( tmp ) )
+    {
+        size_t start = m_Buf.size();
+        m_Buf.resize( start + n + 1 );
+        vsnprintf( &m_Buf[ start ], n + 1, fmt, args_copy );
+        m_Buf.resize( start + n );
+    }
+    else if ( n > 0 )
+    {
+        m_Buf.append( tmp, n );
+    }
+
+    va_end( args_copy );
+    va_end( args );
+}
+
+void FormatBuffer::Write( FILE* fp )
+{
+    if ( fp && !m_Buf.empty() )
+    {
+        fwrite( m_Buf.data(), 1, m_Buf.size(), fp );
+    }
+    m_Buf.clear();
+}
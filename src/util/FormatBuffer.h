@@ -0,0 +1,125 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// Text output buffer with fast number formatting  FormatBuffer.h:
+//
+//   Records are appended to an in-memory buffer and written to the file in
+//   one call.  Integer and fixed point fields are formatted directly; the
+//   output is identical to the printf() conversion named on each method.
+//
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(FORMATBUFFER__INCLUDED_)
+#define FORMATBUFFER__INCLUDED_
+
+#include <cstdio>
+#include <string>
+#include <vector>
+using std::string;
+using std::vector;
+
+class FormatBuffer
+{
+public:
+
+    FormatBuffer();
+    virtual ~FormatBuffer();
+
+    void Clear()
+    {
+        m_Buf.clear();
+    }
+    void Reserve( size_t n )
+    {
+        m_Buf.reserve( n );
+    }
+    size_t Size() const
+    {
+        return m_Buf.size();
+    }
+    const string & Str() const
+    {
+        return m_Buf;
+    }
+
+    void Append( char c )
+    {
+        m_Buf.push_back( c );
+    }
+    void Append( const char* str );
+    void Append( const string & str )
+    {
+        m_Buf.append( str );
+    }
+    void Append( const FormatBuffer & buf )
+    {
+        m_Buf.append( buf.m_Buf );
+    }
+
+    // printf( "%*lld", width, v )
+    void AppendInt( long long int v, int width = 0 );
+
+    // printf( "%*.*f", width, prec, v )
+    void AppendFixed( double v, int prec = 6, int width = 0 );
+
+    // printf( StringUtil::NasFmt( v ).c_str(), v )
+    void AppendNas( double v );
+
+    // snprintf fallback for anything else.
+    void AppendFormat( const char* fmt, ... );
+
+    // Write buffer contents to file and clear buffer.
+    void Write( FILE* fp );
+
+protected:
+
+    void AppendPad( const char* str, int len, int width );
+
+    string m_Buf;
+};
+
+//==== Write Records In Order, Formatting Chunks Of Records In Parallel ====//
+// format_record( FormatBuffer & buf, size_t i ) appends record i to buf.
+template < typename F >
+void WriteRecords( FILE* fp, size_t nrec, F format_record )
+{
+    const size_t chunk_size = 4096;         // Records per chunk
+    const size_t round_size = 64;           // Chunks held in memory at once
+
+    if ( !fp || nrec == 0 )
+    {
+        return;
+    }
+
+    size_t nchunk = ( nrec + chunk_size - 1 ) / chunk_size;
+
+    vector < FormatBuffer > chunk_buf( nchunk < round_size ? nchunk : round_size );
+
+    for ( size_t first = 0; first < nchunk; first += round_size )
+    {
+        long long int nround = ( long long int ) ( nchunk - first < round_size ? nchunk - first : round_size );
+
+        #pragma omp parallel for schedule( dynamic )
+        for ( long long int c = 0; c < nround; c++ )
+        {
+            size_t start = ( first + c ) * chunk_size;
+            size_t end = start + chunk_size < nrec ? start + chunk_size : nrec;
+
+            FormatBuffer & buf = chunk_buf[ c ];
+            buf.Clear();
+            for ( size_t i = start; i < end; i++ )
+            {
+                format_record( buf, i );
+            }
+        }
+
+        for ( long long int c = 0; c < nround; c++ )
+        {
+            chunk_buf[ c ].Write( fp );
+        }
+    }
+}
+
+#endif // !defined(FORMATBUFFER__INCLUDED_)
@@ -11,6 +11,7 @@
 #include <map>
 #include <algorithm>
 #include <limits>
+#include <functional>
 using std::vector;
 using std::deque;
 #include <APIDefines.h>
@@ -38,6 +39,13 @@ bool vector_contains_val( const vector< T > & vec, T const & val )
     return false;
 }
 
+//==== Mix Hash Of Val Into Seed =====//
+template <class T>
+void hash_combine( std::size_t & seed, T const & val )
+{
+    seed ^= std::hash< T >()( val ) + 0x9e3779b9 + ( seed << 6 ) + ( seed >> 2 );
+}
+
 //==== Check If Deque Contains Val =====//
 template <class T>
 bool deque_contains_val( const deque< T > & deque, T const & val )
@@ -11,6 +11,11 @@
 #include "StringUtil.h"
 #include "StlHelper.h"
 #include "VspUtil.h"
+#include "BndBoxTree.h"
+#include "FormatBuffer.h"
+#include "XmlUtil.h"
+#include <algorithm>
+#include <climits>
 
 //==== Test vec2d ====//
 void UtilTestSuite::Vec2dUtilTest()
@@ -747,3 +752,199 @@ void UtilTestSuite::NumbersTest()
 //        printf( "%d\t%f\t%f\t%f\t%f\t%f\n", i, di, magx, magrd, magru, magp1ru );
     }
 }
+
+void UtilTestSuite::BndBoxTreeTest()
+{
+    //==== Grid Of Unit Boxes Spaced 0.75 Apart - Each Overlaps Its Immediate Neighbors ====//
+    vector< BndBox > box_vec;
+    for ( int i = 0; i < 10; i++ )
+    {
+        for ( int j = 0; j < 10; j++ )
+        {
+            for ( int k = 0; k < 3; k++ )
+            {
+                vec3d c( 0.75 * i, 0.75 * j, 2.0 * k );
+                box_vec.push_back( BndBox( c - vec3d( 0.5, 0.5, 0.5 ), c + vec3d( 0.5, 0.5, 0.5 ) ) );
+            }
+        }
+    }
+
+    BndBoxTree tree;
+    tree.Build( box_vec );
+    TEST_ASSERT( tree.GetNumBoxes() == ( int )box_vec.size() );
+
+    //==== Self Overlaps Must Match Brute Force ====//
+    vector< pair< int, int > > tree_pairs;
+    tree.FindOverlaps( tree_pairs );
+    sort( tree_pairs.begin(), tree_pairs.end() );
+
+    vector< pair< int, int > > brute_pairs;
+    for ( int i = 0; i < ( int )box_vec.size(); i++ )
+    {
+        for ( int j = i + 1; j < ( int )box_vec.size(); j++ )
+        {
+            if ( Compare( box_vec[i], box_vec[j] ) )
+            {
+                brute_pairs.push_back( make_pair( i, j ) );
+            }
+        }
+    }
+    TEST_ASSERT( tree_pairs == brute_pairs );
+
+    //==== Tree vs Tree Overlaps ====//
+    vector< BndBox > other_vec;
+    other_vec.push_back( BndBox( vec3d( -1, -1, -1 ), vec3d( 0.1, 0.1, 0.1 ) ) );
+    other_vec.push_back( BndBox( vec3d( 100, 100, 100 ), vec3d( 101, 101, 101 ) ) );
+
+    BndBoxTree other;
+    other.Build( other_vec );
+
+    vector< pair< int, int > > cross_pairs;
+    tree.FindOverlaps( other, cross_pairs );
+    TEST_ASSERT( cross_pairs.size() == 1 );
+    if ( cross_pairs.size() == 1 )
+    {
+        TEST_ASSERT( cross_pairs[0].first == 0 && cross_pairs[0].second == 0 );
+    }
+
+    //==== Point Query ====//
+    vector< int > id_vec;
+    tree.FindContaining( vec3d( 0.375, 0.375, 0.0 ), id_vec );
+    TEST_ASSERT( id_vec.size() == 4 );
+}
+
+void UtilTestSuite::FormatBufferTest()
+{
+    char buf[256];
+
+    //==== Integers ====//
+    long long int ivals[] = { 0, 1, -1, 9, 10, -10, 12345678, -1234567, 123456789012LL, LLONG_MAX, LLONG_MIN };
+    for ( int i = 0; i < ( int )( sizeof( ivals ) / sizeof( ivals[0] ) ); i++ )
+    {
+        FormatBuffer fb;
+        fb.AppendInt( ivals[i], 8 );
+        snprintf( buf, sizeof( buf ), "%8lld", ivals[i] );
+        TEST_ASSERT( fb.Str() == string( buf ) );
+    }
+
+    //==== Fixed Point And NASTRAN Fields Must Match printf ====//
+    vector< double > dvals;
+    double special[] = { 0.0, -0.0, 0.5, -0.5, 1.5, 2.5, 0.125, -0.0000004, 1.0e-9, -1.0e-9, 0.001, 9.9999995,
+                         999999.5, 9999999.5, 1.0e7, -1.0e6, 1.0e300, -1.0e300 };
+    dvals.insert( dvals.end(), special, special + sizeof( special ) / sizeof( special[0] ) );
+
+    double v = 1234567890.1234567890;
+    for ( int i = 0; i < 400; i++ )
+    {
+        dvals.push_back( v );
+        dvals.push_back( -v );
+        dvals.push_back( floor( v * 1000.0 ) / 1000.0 );  // Near rounding ties
+        v = v / 1.7;
+    }
+
+    for ( int i = 0; i < ( int )dvals.size(); i++ )
+    {
+        double d = dvals[i];
+
+        FormatBuffer fb;
+        fb.AppendNas( d );
+        string fmt = StringUtil::NasFmt( d );
+        snprintf( buf, sizeof( buf ), fmt.c_str(), d );
+        TEST_ASSERT( fb.Str() == string( buf ) );
+
+        if ( std::abs( d ) < 1.0e100 )
+        {
+            for ( int prec = 0; prec <= 8; prec++ )
+            {
+                fb.Clear();
+                fb.AppendFixed( d, prec, 8 );
+                snprintf( buf, sizeof( buf ), "%8.*f", prec, d );
+                TEST_ASSERT( fb.Str() == string( buf ) );
+            }
+        }
+    }
+
+    //==== Chunked Records Are Written In Order ====//
+    size_t nrec = 10000;
+
+    FILE* fp = tmpfile();
+    TEST_ASSERT( fp != NULL );
+    if ( fp )
+    {
+        WriteRecords( fp, nrec, [&]( FormatBuffer & fb, size_t i )
+        {
+            fb.AppendInt( ( long long int )i );
+            fb.Append( '\n' );
+        } );
+
+        rewind( fp );
+        bool in_order = true;
+        long long int val;
+        for ( size_t i = 0; i < nrec; i++ )
+        {
+            if ( fscanf( fp, "%lld", &val ) != 1 || val != ( long long int )i )
+            {
+                in_order = false;
+                break;
+            }
+        }
+        TEST_ASSERT( in_order );
+        fclose( fp );
+    }
+}
+
+void UtilTestSuite::Base64Test()
+{
+    //==== Round Trip Every Length Remainder, Including Empty ====//
+    for ( size_t nbytes = 0; nbytes < 12; nbytes++ )
+    {
+        vector< unsigned char > bytes( nbytes );
+        for ( size_t i = 0; i < nbytes; i++ )
+        {
+            bytes[i] = ( unsigned char )( ( i * 97 + 255 ) & 0xFF );    // Covers 0x00 and 0xFF
+        }
+
+        string str = XmlUtil::EncodeBase64( bytes.data(), nbytes );
+        TEST_ASSERT( str.size() == 4 * ( ( nbytes + 2 ) / 3 ) );
+
+        vector< unsigned char > data;
+        TEST_ASSERT( XmlUtil::DecodeBase64( str.c_str(), str.size(), data ) );
+        TEST_ASSERT( data == bytes );
+
+        //==== Whitespace Anywhere Is Skipped ====//
+        string spaced = " ";
+        for ( size_t i = 0; i < str.size(); i++ )
+        {
+            spaced.push_back( str[i] );
+            if ( i % 4 == 3 )
+            {
+                spaced += "\n\t ";
+            }
+        }
+
+        TEST_ASSERT( XmlUtil::DecodeBase64( spaced.c_str(), spaced.size(), data ) );
+        TEST_ASSERT( data == bytes );
+    }
+
+    //==== Known Encodings ====//
+    const char * plain = "Man";
+    TEST_ASSERT( XmlUtil::EncodeBase64( ( const unsigned char * )plain, 3 ) == "TWFu" );
+    TEST_ASSERT( XmlUtil::EncodeBase64( ( const unsigned char * )plain, 2 ) == "TWE=" );
+    TEST_ASSERT( XmlUtil::EncodeBase64( ( const unsigned char * )plain, 1 ) == "TQ==" );
+
+    //==== Ints And Doubles Survive Byte For Byte ====//
+    vector< double > dvec = { 0.0, -1.5, 1.0e-300, 3.141592653589793, DBL_MAX };
+    string dstr = XmlUtil::EncodeBase64( ( const unsigned char * )dvec.data(), dvec.size() * sizeof( double ) );
+    vector< unsigned char > ddata;
+    TEST_ASSERT( XmlUtil::DecodeBase64( dstr.c_str(), dstr.size(), ddata ) );
+    TEST_ASSERT( ddata.size() == dvec.size() * sizeof( double ) );
+    TEST_ASSERT( memcmp( ddata.data(), dvec.data(), ddata.size() ) == 0 );
+
+    //==== Malformed Text Is Rejected ====//
+    const char * bad[] = { "TW!u", "T", "TWFuT", "TQ==TQ==", "TQ=x", "TWFu\x80" };
+    for ( int i = 0; i < ( int )( sizeof( bad ) / sizeof( bad[0] ) ); i++ )
+    {
+        vector< unsigned char > data;
+        TEST_ASSERT( !XmlUtil::DecodeBase64( bad[i], strlen( bad[i] ), data ) );
+    }
+}
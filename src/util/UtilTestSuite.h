@@ -38,6 +38,9 @@ public:
         TEST_ADD( UtilTestSuite::BilinearInterpTest )
         TEST_ADD( UtilTestSuite::FormatWidthTest )
         TEST_ADD( UtilTestSuite::NumbersTest )
+        TEST_ADD( UtilTestSuite::BndBoxTreeTest )
+        TEST_ADD( UtilTestSuite::FormatBufferTest )
+        TEST_ADD( UtilTestSuite::Base64Test )
     }
 
 private:
@@ -52,6 +55,9 @@ private:
     void BilinearInterpTest();
     void FormatWidthTest();
     void NumbersTest();
+    void BndBoxTreeTest();
+    void FormatBufferTest();
+    void Base64Test();
 
     static void WritePntVecs( vector< vector< vec3d > > & pnt_vecs,  string file_name );
     void WriteCurve( VspCurve& crv, string file_name );
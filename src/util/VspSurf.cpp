@@ -769,6 +769,21 @@ void VspSurf::SkinRibs( const vector<rib_data_type> &ribs, bool closed_flag )
     SkinRibs( ribs, degree, closed_flag );
 }
 
+//==== Copy Everything A Skin Call Sets ====//
+void VspSurf::CopySkin( const VspSurf &surf )
+{
+    m_Surface = surf.m_Surface;
+
+    ResetFlipNormal();
+    ResetUSkip();
+
+    m_SkinType = surf.m_SkinType;
+    m_SkinRibVec = surf.m_SkinRibVec;
+    m_SkinDegreeVec = surf.m_SkinDegreeVec;
+    m_SkinParmVec = surf.m_SkinParmVec;
+    m_SkinClosedFlag = surf.m_SkinClosedFlag;
+}
+
 void VspSurf::SkinCubicSpline( const vector<rib_data_type> &ribs, const vector<double> &param, const vector <double> &tdisc, const vector < int > &degree, bool closed_flag )
 {
     spline_creator_type sc;
@@ -1751,7 +1766,7 @@ void VspSurf::SplitTesselate( const vector<int> &num_u, int num_v, std::vector<
 // VspSurf::TesselateTEforWake
 // Low level routine that actually calls Code-Eli to evaluate grid of points.
 // No smarts about what U/V tess to work on, just evaluates what it is told.
-// Also called by SplitTess below.
+// Also called by SplitTess below.  Blocks of U rows are evaluated in parallel.
 void VspSurf::Tesselate( const vector<double> &u, const vector<double> &v, std::vector< vector< vec3d > > & pnts,  std::vector< vector< vec3d > > & norms,  std::vector< vector< vec3d > > & uw_pnts ) const
 {
     if ( u.size() == 0 || v.size() == 0 )
@@ -1760,60 +1775,82 @@ void VspSurf::Tesselate( const vector<double> &u, const vector<double> &v, std::
         return;
     }
 
-    unsigned int nu = (unsigned int)u.size();
-    unsigned int nv = (unsigned int)v.size();
-
-    vector < vector < surface_point_type > > ptmat, nmat;
-
-    m_Surface.f_pt_normal_grid( u, v, ptmat, nmat);
+    int nu = ( int )u.size();
+    int nv = ( int )v.size();
 
     // resize pnts and norms
     pnts.resize( nu );
     norms.resize( nu );
     uw_pnts.resize( nu );
-    for ( surface_index_type i = 0; i < nu; ++i )
+    for ( int i = 0; i < nu; ++i )
     {
         pnts[i].resize( nv );
         norms[i].resize( nv );
         uw_pnts[i].resize( nv );
+    }
+
+    double tmax = GetWMax();
+    double thalf = 0.5 * GetWMax();
+
+    // Code-Eli picks the neighboring patch for a parameter that lands exactly on a patch
+    // boundary at either end of the evaluation vector.  Each block is evaluated with an
+    // extra row on both sides so interior rows match a single whole-grid evaluation.
+    const int block_rows = 32;
+    int nblock = ( nu + block_rows - 1 ) / block_rows;
+
+    #pragma omp parallel for schedule( dynamic )
+    for ( int b = 0; b < nblock; b++ )
+    {
+        int ibegin = b * block_rows;
+        int iend = std::min( ibegin + block_rows, nu );
+        int ipad = std::max( ibegin - 1, 0 );
 
-        for ( surface_index_type j = 0; j < nv; j++ )
+        vector < double > ublock( u.begin() + ipad, u.begin() + std::min( iend + 1, nu ) );
+        vector < vector < surface_point_type > > ptmat, nmat;
+
+        m_Surface.f_pt_normal_grid( ublock, v, ptmat, nmat );
+
+        for ( int i = ibegin; i < iend; i++ )
         {
-            pnts[i][j] = ptmat[i][j];
+            const vector < surface_point_type > & ptrow = ptmat[ i - ipad ];
+            const vector < surface_point_type > & nrow = nmat[ i - ipad ];
 
-            vec3d norm = nmat[i][j];
-            if ( norm.mag() < 1e-6 ) // Zero normal vector
+            for ( int j = 0; j < nv; j++ )
             {
-                double tmax = GetWMax();
-                double thalf = 0.5 * GetWMax();
-                if ( v[j] <= TMAGIC ) // Near TE lower
-                {
-                    norm = CompNorm( u[i], TMAGIC + 1e-6 );
-                }
-                else if ( v[j] <= thalf && v[j] >= ( thalf - TMAGIC ) ) // Near leading edge
+                pnts[i][j] = ptrow[j];
+                uw_pnts[i][j].set_xyz( u[i], v[j], 0.0 );
+
+                vec3d norm = nrow[j];
+                if ( norm.mag() < 1e-6 ) // Zero normal vector
                 {
-                    norm = CompNorm( u[i], thalf - ( TMAGIC + 1e-6 ) );
+                    if ( v[j] <= TMAGIC ) // Near TE lower
+                    {
+                        norm = CompNorm( u[i], TMAGIC + 1e-6 );
+                    }
+                    else if ( v[j] <= thalf && v[j] >= ( thalf - TMAGIC ) ) // Near leading edge
+                    {
+                        norm = CompNorm( u[i], thalf - ( TMAGIC + 1e-6 ) );
+                    }
+                    else if ( v[j] >= thalf && v[j] <= ( thalf + TMAGIC ) ) // Near leading edge
+                    {
+                        norm = CompNorm( u[i], thalf + TMAGIC + 1e-6 );
+                    }
+                    else if ( v[j] >= ( tmax - TMAGIC ) ) // Near TE upper
+                    {
+                        norm = CompNorm( u[i], tmax - ( TMAGIC + 1e-6 ) );
+                    }
+                    norm.normalize();
                 }
-                else if ( v[j] >= thalf && v[j] <= ( thalf + TMAGIC ) ) // Near leading edge
+
+                if ( m_FlipNormal )
                 {
-                    norm = CompNorm( u[i], thalf + TMAGIC + 1e-6 );
+                    norms[i][j] = -1.0 * norm;
                 }
-                else if ( v[j] >= ( tmax - TMAGIC ) ) // Near TE upper
+                else
                 {
-                    norm = CompNorm( u[i], tmax - ( TMAGIC + 1e-6 ) );
+                    norms[i][j] = norm;
                 }
-                norm.normalize();
-            }
-
-            if ( m_FlipNormal )
-            {
-                norms[i][j] = -1.0 * norm;
-            }
-            else
-            {
-                norms[i][j] = norm;
             }
-            uw_pnts[i][j].set_xyz( u[i], v[j], 0.0 );
         }
     }
 }
@@ -62,6 +62,9 @@ public:
     void SkinRibs( const vector<rib_data_type> &ribs, const vector < int > &degree, bool closed_flag );
     void SkinRibs( const vector<rib_data_type> &ribs, bool closed_flag );
 
+    // Copy the result of a Skin* call on surf without repeating the skinning
+    void CopySkin( const VspSurf &surf );
+
     void SkinCubicSpline( const vector<rib_data_type> &ribs, const vector<double> &param, const vector <double> &tdisc, const vector < int > &degree, bool closed_flag );
     void SkinCubicSpline( const vector<rib_data_type> &ribs, const vector<double> &param, const vector <double> &tdisc, bool closed_flag );
     void SkinCubicSpline( const vector<rib_data_type> &ribs, const vector<double> &param, bool closed_flag );
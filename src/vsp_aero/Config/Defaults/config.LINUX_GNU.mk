@@ -10,7 +10,7 @@ CXX = g++
 SOLVER_CXXFLAGS = -fPIC -std=c++11 -O3 -funroll-loops -funroll-all-loops -Wno-unused -Wno-format-security -Wno-format-overflow
 # Reasonable debug flags
 # SOLVER_CXXFLAGS = -fPIC -O0 -g -fsanitize=address
-SOLVER_LDFLAGS =
+SOLVER_LDFLAGS = -pthread
 ARFLAGS = rcs
 
 # These are extra CXXFLAGS and LDFLAGS specific to building the viewer.
@@ -7,6 +7,7 @@
 #include "XmlUtil.h"
 #include "StringUtil.h"
 #include <cfloat>
+#include <cctype>
 
 //==== Get Number of Same Names ====//
 unsigned int XmlUtil::GetNumNames( xmlNodePtr node, const char * name )
@@ -710,6 +711,156 @@ xmlNodePtr XmlUtil::DecodeFileContents( xmlNodePtr root, const char* file_name )
     return file_node;
 }
 
+static const char base64_chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+//==== Encode Bytes As Base64 Text ====//
+string XmlUtil::EncodeBase64( const unsigned char * data, size_t nbytes )
+{
+    string str;
+    str.reserve( 4 * ( ( nbytes + 2 ) / 3 ) );
+
+    size_t i = 0;
+    for ( ; i + 2 < nbytes ; i += 3 )
+    {
+        unsigned int n = ( data[i] << 16 ) | ( data[i + 1] << 8 ) | data[i + 2];
+        str.push_back( base64_chars[ ( n >> 18 ) & 63 ] );
+        str.push_back( base64_chars[ ( n >> 12 ) & 63 ] );
+        str.push_back( base64_chars[ ( n >> 6 ) & 63 ] );
+        str.push_back( base64_chars[ n & 63 ] );
+    }
+
+    if ( i < nbytes )
+    {
+        unsigned int n = data[i] << 16;
+        if ( i + 1 < nbytes )
+        {
+            n |= data[i + 1] << 8;
+        }
+        str.push_back( base64_chars[ ( n >> 18 ) & 63 ] );
+        str.push_back( base64_chars[ ( n >> 12 ) & 63 ] );
+        str.push_back( i + 1 < nbytes ? base64_chars[ ( n >> 6 ) & 63 ] : '=' );
+        str.push_back( '=' );
+    }
+
+    return str;
+}
+
+//==== Decode Base64 Text, Whitespace Is Skipped, False On Malformed Text ====//
+bool XmlUtil::DecodeBase64( const char * str, size_t len, vector< unsigned char > & data )
+{
+    signed char lookup[256];
+    memset( lookup, -1, sizeof( lookup ) );
+    for ( int i = 0 ; i < 64 ; i++ )
+    {
+        lookup[ ( unsigned char ) base64_chars[i] ] = i;
+    }
+
+    data.clear();
+    data.reserve( 3 * ( len / 4 ) );
+
+    unsigned int n = 0;
+    int nbits = 0;
+    size_t nchar = 0;
+    for ( size_t i = 0 ; i < len ; i++ )
+    {
+        unsigned char c = str[i];
+        if ( c == '=' )
+        {
+            // Only padding and whitespace may follow
+            for ( ; i < len ; i++ )
+            {
+                if ( str[i] != '=' && !isspace( ( unsigned char ) str[i] ) )
+                {
+                    return false;
+                }
+            }
+            break;
+        }
+        if ( isspace( c ) )
+        {
+            continue;
+        }
+        if ( lookup[c] < 0 )
+        {
+            return false;
+        }
+
+        n = ( n << 6 ) | lookup[c];
+        nbits += 6;
+        nchar++;
+        if ( nbits >= 8 )
+        {
+            nbits -= 8;
+            data.push_back( ( n >> nbits ) & 0xFF );
+        }
+    }
+
+    // A lone trailing character can not hold a whole byte
+    return nchar % 4 != 1;
+}
+
+//==== Create Node With Ints As Base64 ====//
+xmlNodePtr XmlUtil::AddVectorIntBinaryNode( xmlNodePtr root, const char * name, const vector< int > & vec )
+{
+    string str = EncodeBase64( ( const unsigned char * ) vec.data(), vec.size() * sizeof( int ) );
+    return xmlNewChild( root, NULL, ( const xmlChar * )name, ( const xmlChar * )str.c_str() );
+}
+
+//==== Create Node With Doubles As Base64 ====//
+xmlNodePtr XmlUtil::AddVectorDoubleBinaryNode( xmlNodePtr root, const char * name, const vector< double > & vec )
+{
+    string str = EncodeBase64( ( const unsigned char * ) vec.data(), vec.size() * sizeof( double ) );
+    return xmlNewChild( root, NULL, ( const xmlChar * )name, ( const xmlChar * )str.c_str() );
+}
+
+//==== Decode Base64 Node Contents Into Bytes ====//
+static bool ExtractBinaryNode( xmlNodePtr root, const char * name, vector< unsigned char > & data )
+{
+    xmlNodePtr node = XmlUtil::GetNode( root, name, 0 );
+    if ( !node )
+    {
+        return false;
+    }
+
+    xmlChar* str = xmlNodeGetContent( node );
+    if ( !str )
+    {
+        return false;
+    }
+
+    bool ok = XmlUtil::DecodeBase64( ( const char * ) str, xmlStrlen( str ), data );
+    xmlFree( str );
+    return ok;
+}
+
+//==== Extract Vector Of Ints Stored As Base64 ====//
+vector< int > XmlUtil::ExtractVectorIntBinaryNode( xmlNodePtr root, const char * name )
+{
+    vector< int > ret_vec;
+    vector< unsigned char > data;
+
+    if ( ExtractBinaryNode( root, name, data ) )
+    {
+        ret_vec.resize( data.size() / sizeof( int ) );
+        memcpy( ret_vec.data(), data.data(), ret_vec.size() * sizeof( int ) );
+    }
+    return ret_vec;
+}
+
+//==== Extract Vector Of Doubles Stored As Base64 ====//
+vector< double > XmlUtil::ExtractVectorDoubleBinaryNode( xmlNodePtr root, const char * name )
+{
+    vector< double > ret_vec;
+    vector< unsigned char > data;
+
+    if ( ExtractBinaryNode( root, name, data ) )
+    {
+        ret_vec.resize( data.size() / sizeof( double ) );
+        memcpy( ret_vec.data(), data.data(), ret_vec.size() * sizeof( double ) );
+    }
+    return ret_vec;
+}
+
 //==== Convert Chars Such As & < and > to XML Versions ====//
 string XmlUtil::ConvertToXMLSafeChars( const string & input )
 {
@@ -68,6 +68,14 @@ vec2d GetVec2dNode( xmlNodePtr node );
 vec3d GetVec3dNode( xmlNodePtr node );
 vector< vec3d > GetVectorVec3dNode( xmlNodePtr node );
 
+// Raw little-endian arrays stored as base64 text, much smaller and faster than comma lists
+string EncodeBase64( const unsigned char * data, size_t nbytes );
+bool DecodeBase64( const char * str, size_t len, vector< unsigned char > & data );
+xmlNodePtr AddVectorIntBinaryNode( xmlNodePtr root, const char * name, const vector< int > & vec );
+xmlNodePtr AddVectorDoubleBinaryNode( xmlNodePtr root, const char * name, const vector< double > & vec );
+vector< int >    ExtractVectorIntBinaryNode( xmlNodePtr root, const char * name );
+vector< double > ExtractVectorDoubleBinaryNode( xmlNodePtr root, const char * name );
+
 xmlNodePtr EncodeFileContents( xmlNodePtr root, const char* file_name );
 xmlNodePtr DecodeFileContents( xmlNodePtr root, const char* file_name );
 